@@ -4,13 +4,10 @@
 #include "AppDelegate.h"
 #include "controllers/GameController.h"  
 #include "HelloWorldScene.h"
-
-// 引入 Windows 头文件以使用 OutputDebugStringA
-#if (CC_TARGET_PLATFORM == CC_PLATFORM_WIN32)
-#include <windows.h>
-#endif
-#include <stdio.h>
-#include <stdarg.h> // 引入可变参数头文件
+#include "utils/TraceProfiler.h"
+#include "utils/AssetBuckets.h"
+#include "utils/Logger.h"
+#include "utils/StartupTimeline.h"
 
 // #define USE_AUDIO_ENGINE 1
 // #define USE_SIMPLE_AUDIO_ENGINE 1
@@ -29,29 +26,6 @@ using namespace CocosDenshion;
 
 USING_NS_CC;
 
-// DebugLog 函数实现
-void DebugLog(const char* format, ...) {
-    char buffer[2048];
-    va_list args;
-    va_start(args, format);
-    vsnprintf(buffer, sizeof(buffer), format, args);
-    va_end(args);
-
-    // 1. 输出到 Cocos 控制台
-    cocos2d::log("%s", buffer);
-
-#if (CC_TARGET_PLATFORM == CC_PLATFORM_WIN32)
-    // 2. 输出到 Visual Studio 的 "输出" 窗口
-    OutputDebugStringA(buffer);
-    OutputDebugStringA("\n");
-#endif
-}
-
-static cocos2d::Size designResolutionSize = cocos2d::Size(480, 320);
-static cocos2d::Size smallResolutionSize = cocos2d::Size(480, 320);
-static cocos2d::Size mediumResolutionSize = cocos2d::Size(1024, 768);
-static cocos2d::Size largeResolutionSize = cocos2d::Size(2048, 1536);
-
 AppDelegate::AppDelegate()
     : _gameController(nullptr)
 {
@@ -65,6 +39,7 @@ AppDelegate::~AppDelegate() {
 #endif
     // 释放控制器
     CC_SAFE_RELEASE(_gameController);
+    Logger::getInstance()->flush();
 }
 
 void AppDelegate::initGLContextAttrs() {
@@ -77,6 +52,7 @@ static int register_all_packages() {
 }
 
 bool AppDelegate::applicationDidFinishLaunching() {
+    StartupTimeline::mark("applicationDidFinishLaunching");
     auto director = Director::getInstance();
     auto glview = director->getOpenGLView();
     if (!glview) {
@@ -90,24 +66,12 @@ bool AppDelegate::applicationDidFinishLaunching() {
     }
 
     director->setDisplayStats(true);
+    // 全速帧率；画面静止时由 GameView 的 FrameRateGovernor 临时降低
     director->setAnimationInterval(1.0f / 60);
 
     // 设置设计分辨率
     glview->setDesignResolutionSize(1080, 2080, ResolutionPolicy::FIXED_WIDTH);
-    auto frameSize = glview->getFrameSize();
-
-    if (frameSize.height > mediumResolutionSize.height) {
-        director->setContentScaleFactor(MIN(largeResolutionSize.height / designResolutionSize.height,
-            largeResolutionSize.width / designResolutionSize.width));
-    }
-    else if (frameSize.height > smallResolutionSize.height) {
-        director->setContentScaleFactor(MIN(mediumResolutionSize.height / designResolutionSize.height,
-            mediumResolutionSize.width / designResolutionSize.width));
-    }
-    else {
-        director->setContentScaleFactor(MIN(smallResolutionSize.height / designResolutionSize.height,
-            smallResolutionSize.width / designResolutionSize.width));
-    }
+    StartupTimeline::mark("GL view ready");
 
     register_all_packages();
 
@@ -117,33 +81,51 @@ bool AppDelegate::applicationDidFinishLaunching() {
     FileUtils::getInstance()->addSearchPath("number");
     FileUtils::getInstance()->addSearchPath("levels");  // 不带 Resources/ 前缀
 
-    DebugLog("=== AppDelegate: 应用启动 ===");
+    // 按屏幕宽度选择预缩放美术的档位，同时设置 ContentScaleFactor
+    AssetBuckets::apply(glview->getFrameSize());
+    StartupTimeline::mark("asset buckets selected");
+
+    CM_LOG_INFO(LC_APP, "=== AppDelegate: 应用启动 ===");
 
     auto scene = Scene::create();
-    DebugLog("=== AppDelegate: 场景已创建 ===");
+    StartupTimeline::mark("scene created");
+    CM_LOG_INFO(LC_APP, "=== AppDelegate: 场景已创建 ===");
 
     // 创建控制器并启动游戏
     _gameController = GameController::create();
     if (_gameController) {
         _gameController->retain(); // 必须 retain，防止被自动释放
-        DebugLog("=== AppDelegate: GameController 已创建，调用 startGame ===");
+        CM_LOG_INFO(LC_APP, "=== AppDelegate: GameController 已创建，调用 startGame ===");
         _gameController->startGame(scene);
     }
     else {
-        DebugLog("=== AppDelegate: GameController 创建失败 ===");
+        CM_LOG_ERROR(LC_APP, "=== AppDelegate: GameController 创建失败 ===");
         auto defaultScene = HelloWorld::createScene();
         director->runWithScene(defaultScene);
         return false;
     }
 
     director->runWithScene(scene);
-    DebugLog("=== AppDelegate: 场景已运行 ===");
+    CM_LOG_INFO(LC_APP, "=== AppDelegate: 场景已运行 ===");
 
     return true;
 }
 
 void AppDelegate::applicationDidEnterBackground() {
     Director::getInstance()->stopAnimation();
+
+    // 进入后台后进程可能被系统直接结束，先写出遥测缓冲
+    if (_gameController) {
+        _gameController->flushTelemetry();
+    }
+
+#if CM_ENABLE_TRACE
+    // 切到后台时导出追踪数据，可直接拖入 chrome://tracing 查看
+    std::string tracePath = FileUtils::getInstance()->getWritablePath() + "cardmatch_trace.json";
+    if (TraceProfiler::getInstance()->exportChromeTrace(tracePath)) {
+        CM_LOG_INFO(LC_APP, "=== AppDelegate: trace 已导出到 %s ===", tracePath.c_str());
+    }
+#endif
 #if USE_AUDIO_ENGINE
     AudioEngine::pauseAll();
 #elif USE_SIMPLE_AUDIO_ENGINE
@@ -30,4 +30,12 @@ enum CardFaceType {
     CFT_NUM_CARD_FACE_TYPES
 };
 
+// Ƴߴ磺Ƶͼ card_general.png Ϊ 182 x 282CardView Ŵ 3.0 ʾ
+// ģͳߴڵжĻʵʾĴС
+const float kCardArtWidth = 182.0f;
+const float kCardArtHeight = 282.0f;
+const float kCardViewScale = 3.0f;
+const float kCardWidth = kCardArtWidth * kCardViewScale;    // 546
+const float kCardHeight = kCardArtHeight * kCardViewScale;  // 846
+
 #endif // __GAME_CONSTANTS_H__
\ No newline at end of file
@@ -1,6 +1,8 @@
 #ifndef __LEVEL_CONFIG_H__
 #define __LEVEL_CONFIG_H__
 
+#include "configs/MatchRules.h"
+#include <cstdint>
 #include <vector>
 
 /**
@@ -14,6 +16,7 @@ struct CardConfigData {
     int suit;   ///< ɫ0-3
     float x;    ///< X 
     float y;    ///< Y 
+    std::vector<int> coveredBy;  ///< ڵƵϷ±꣨ϷЧ
 };
 
 /**
@@ -25,6 +28,24 @@ struct CardConfigData {
 struct LevelConfig {
     std::vector<CardConfigData> playfieldCards;  ///< Ϸб
     std::vector<CardConfigData> stackCards;      ///< ƶѿб
+    bool occlusionResolved;                      ///< ϷƵ coveredBy ǷѼ
+    MatchRuleType matchRule;                     ///< ƥ򣬹ؿļδָʱΪ TriPeaks
+
+    LevelConfig() : occlusionResolved(false), matchRule(MRT_TRIPEAKS) {}
+};
+
+/**
+ * @struct LevelPackEntry
+ * @brief ؿеһؿ
+ * 
+ * ؿֻӣ LevelMaterializer ԭĽ濨
+ */
+struct LevelPackEntry {
+    uint64_t seed;          ///< ؿ
+    bool solvable;          ///< Ƿɽ
+    int solutionMoves;      ///< ҵĽⷨƣɽʱΪ 0
+
+    LevelPackEntry() : seed(0), solvable(false), solutionMoves(0) {}
 };
 
 #endif
\ No newline at end of file
@@ -1,6 +1,9 @@
 #include "LevelConfigLoader.h"
 #include "json/document.h"
 #include "cocos2d.h"
+#include "services/LevelMaterializer.h"
+#include "utils/Logger.h"
+#include "utils/TraceProfiler.h"
 
 USING_NS_CC;
 
@@ -24,6 +27,14 @@ namespace {
             data.x = 0;
             data.y = 0;
         }
+
+        // ؿ빤дڵбϷ±꣩
+        if (jsonObj.HasMember("CoveredBy") && jsonObj["CoveredBy"].IsArray()) {
+            const rapidjson::Value& covers = jsonObj["CoveredBy"];
+            for (rapidjson::SizeType i = 0; i < covers.Size(); i++) {
+                data.coveredBy.push_back(covers[i].GetInt());
+            }
+        }
         return data;
     }
 
@@ -43,12 +54,13 @@ namespace {
 }
 
 LevelConfig LevelConfigLoader::loadLevelConfig(const std::string& filename) {
+    CM_TRACE_SCOPE("LevelConfigLoader::loadLevelConfig");
     LevelConfig config;
 
     // ȡļ
     std::string content = FileUtils::getInstance()->getStringFromFile(filename);
     if (content.empty()) {
-        CCLOG("Config file not found: %s", filename.c_str());
+        CM_LOG_WARN(LC_GAME, "Config file not found: %s", filename.c_str());
         return config;
     }
 
@@ -56,7 +68,7 @@ LevelConfig LevelConfigLoader::loadLevelConfig(const std::string& filename) {
     rapidjson::Document doc;
     doc.Parse(content.c_str());
     if (doc.HasParseError()) {
-        CCLOG("JSON parse error in file: %s", filename.c_str());
+        CM_LOG_WARN(LC_GAME, "JSON parse error in file: %s", filename.c_str());
         return config;
     }
 
@@ -65,10 +77,55 @@ LevelConfig LevelConfigLoader::loadLevelConfig(const std::string& filename) {
         config.playfieldCards = parseCardArray(doc["Playfield"], true);
     }
 
+    // ؿ빤ߴļ OcclusionBaked ǣڵϵֱʹ CoveredBy
+    config.occlusionResolved = doc.HasMember("OcclusionBaked") && doc["OcclusionBaked"].IsBool()
+        && doc["OcclusionBaked"].GetBool();
+
+    // ƥ򣨿ѡ޷ʶĹĬϹ
+    if (doc.HasMember("MatchRule") && doc["MatchRule"].IsString()
+        && !parseMatchRuleName(doc["MatchRule"].GetString(), config.matchRule)) {
+        CM_LOG_WARN(LC_GAME, "Unknown MatchRule '%s' in %s, using TriPeaks", doc["MatchRule"].GetString(), filename.c_str());
+    }
+
     // ѵƣλã
     if (doc.HasMember("Stack") && doc["Stack"].IsArray()) {
         config.stackCards = parseCardArray(doc["Stack"], false);
     }
 
     return config;
-}
\ No newline at end of file
+}
+
+std::vector<LevelPackEntry> LevelConfigLoader::loadLevelPack(const std::string& filename) {
+    CM_TRACE_SCOPE("LevelConfigLoader::loadLevelPack");
+    std::vector<LevelPackEntry> entries;
+
+    std::string content = FileUtils::getInstance()->getStringFromFile(filename);
+    if (content.empty()) {
+        CM_LOG_WARN(LC_GAME, "Level pack not found: %s", filename.c_str());
+        return entries;
+    }
+
+    rapidjson::Document doc;
+    doc.Parse(content.c_str());
+    if (doc.HasParseError() || !doc.HasMember("Levels") || !doc["Levels"].IsArray()) {
+        CM_LOG_WARN(LC_GAME, "JSON parse error in level pack: %s", filename.c_str());
+        return entries;
+    }
+
+    // ʮַ棬 64 λ JSON ֵжʧ
+    const rapidjson::Value& levels = doc["Levels"];
+    entries.reserve(levels.Size());
+    for (rapidjson::SizeType i = 0; i < levels.Size(); i++) {
+        const rapidjson::Value& level = levels[i];
+        LevelPackEntry entry;
+        if (!level.HasMember("Seed") || !level["Seed"].IsString()
+            || !LevelMaterializer::parseSeed(level["Seed"].GetString(), entry.seed)) {
+            CM_LOG_WARN(LC_GAME, "Invalid seed in level pack %s, entry %u skipped", filename.c_str(), (unsigned)i);
+            continue;
+        }
+        entry.solvable = level.HasMember("Solvable") && level["Solvable"].IsBool() && level["Solvable"].GetBool();
+        entry.solutionMoves = level.HasMember("Moves") && level["Moves"].IsInt() ? level["Moves"].GetInt() : 0;
+        entries.push_back(entry);
+    }
+    return entries;
+}
@@ -4,6 +4,7 @@
 
 #include "configs/LevelConfig.h"
 #include <string>
+#include <vector>
 
 /**
  * @class LevelConfigLoader
@@ -11,6 +12,7 @@
  * 
  * ְ
  * -  JSON ļعؿ
+ * - ֻӵĹؿ
  * - ݣɫλã
  * - תΪ LevelConfig ṹ
  * 
@@ -30,6 +32,13 @@ public:
      * @return ؿöļڻʧܷؿ
      */
     static LevelConfig loadLevelConfig(const std::string& filename);
+
+    /**
+     * @brief عؿ
+     * @param filename ؿļԴĿ¼ tools/level_pack ɣ
+     * @return ؿбļڻʧܷؿб޷Ŀ
+     */
+    static std::vector<LevelPackEntry> loadLevelPack(const std::string& filename);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,166 @@
+#ifndef __MATCH_RULES_H__
+#define __MATCH_RULES_H__
+
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @enum MatchRuleType
+ * @brief ؿʹõƥ
+ */
+enum MatchRuleType {
+    MRT_TRIPEAKS = 0,     ///<  1A  K ĬϹ
+    MRT_GOLF,             ///<  1A  K 
+    MRT_PYRAMID,          ///< Ƶ֮Ϊ 13
+    MRT_SUIT_SEQUENCE,    ///< ͬɫҵ 1A  K 
+    MRT_NUM_RULES
+};
+
+// ---------------------------------------------------------------------
+// ԣÿֹ constexpr  pairs() Щӣ
+// kSameSuit ʾǷҪɫͬΧ 1-13 CardConfigData һ
+// ---------------------------------------------------------------------
+
+struct TriPeaksRule {
+    static constexpr MatchRuleType kType = MRT_TRIPEAKS;
+    static constexpr bool kSameSuit = false;
+    static constexpr bool pairs(int a, int b) {
+        return a - b == 1 || b - a == 1 || (a == 1 && b == 13) || (a == 13 && b == 1);
+    }
+};
+
+struct GolfRule {
+    static constexpr MatchRuleType kType = MRT_GOLF;
+    static constexpr bool kSameSuit = false;
+    static constexpr bool pairs(int a, int b) {
+        return a - b == 1 || b - a == 1;
+    }
+};
+
+struct PyramidRule {
+    static constexpr MatchRuleType kType = MRT_PYRAMID;
+    static constexpr bool kSameSuit = false;
+    static constexpr bool pairs(int a, int b) {
+        return a + b == 13;
+    }
+};
+
+struct SuitSequenceRule {
+    static constexpr MatchRuleType kType = MRT_SUIT_SEQUENCE;
+    static constexpr bool kSameSuit = true;
+    static constexpr bool pairs(int a, int b) {
+        return TriPeaksRule::pairs(a, b);
+    }
+};
+
+// ---------------------------------------------------------------------
+// ڽӱkMasks[a] ĵ b λʾ a  b 
+// ---------------------------------------------------------------------
+
+template <int... Is>
+struct MatchIndexSequence {};
+
+template <int N, int... Is>
+struct MakeMatchIndexSequence : MakeMatchIndexSequence<N - 1, N - 1, Is...> {};
+
+template <int... Is>
+struct MakeMatchIndexSequence<0, Is...> {
+    typedef MatchIndexSequence<Is...> type;
+};
+
+/**
+ * @brief  a ڽ루C++11 constexpr ֻдɵ return ĵݹ飩
+ */
+template <class Rule>
+constexpr uint16_t buildMatchMask(int a, int b) {
+    return b > 13 ? 0
+        : (uint16_t)(((a >= 1 && a <= 13 && b >= 1 && Rule::pairs(a, b)) ? (1u << b) : 0u)
+                     | buildMatchMask<Rule>(a, b + 1));
+}
+
+template <class Rule, class Sequence>
+struct MatchTableBuilder;
+
+template <class Rule, int... Is>
+struct MatchTableBuilder<Rule, MatchIndexSequence<Is...> > {
+    static constexpr uint16_t kMasks[sizeof...(Is)] = { buildMatchMask<Rule>(Is, 0)... };
+};
+
+template <class Rule, int... Is>
+constexpr uint16_t MatchTableBuilder<Rule, MatchIndexSequence<Is...> >::kMasks[sizeof...(Is)];
+
+/**
+ * @class MatchPolicy
+ * @brief չƥж
+ *
+ * ְ
+ * - Ϊÿֹһ 16 ıڽӱ
+ * - matches() ֻλͻɫȽϣûз֧Ҳû麯
+ *
+ * ʹó
+ * LevelSolver ԹΪģʵѭ
+ * GameModel ùؿʱѡһΰʵĿɳɨ裬 canMatch ж getMatchFunction ĺָ
+ */
+template <class Rule>
+class MatchPolicy {
+public:
+    typedef MatchTableBuilder<Rule, typename MakeMatchIndexSequence<16>::type> Table;
+
+    static bool matches(int faceA, int suitA, int faceB, int suitB) {
+        // Խ -1 ʾġơλ䵽 0..15 ֮ıΪ false
+        unsigned a = (unsigned)faceA;
+        unsigned b = (unsigned)faceB;
+        unsigned inRange = (unsigned)(a < 16) & (unsigned)(b < 16);
+        unsigned adjacent = (Table::kMasks[a & 15] >> (b & 15)) & 1u;
+        unsigned suitOk = (unsigned)!Rule::kSameSuit | (unsigned)(suitA == suitB);
+        return (adjacent & inRange & suitOk) != 0;
+    }
+};
+
+/**
+ * @brief ƥ亯ָͣ getMatchFunction ѡ
+ */
+typedef bool (*MatchFunction)(int faceA, int suitA, int faceB, int suitB);
+
+/**
+ * @brief ȡӦƥ亯δ֪򷵻ĬϹ
+ */
+inline MatchFunction getMatchFunction(MatchRuleType type) {
+    switch (type) {
+        case MRT_GOLF:          return &MatchPolicy<GolfRule>::matches;
+        case MRT_PYRAMID:       return &MatchPolicy<PyramidRule>::matches;
+        case MRT_SUIT_SEQUENCE: return &MatchPolicy<SuitSequenceRule>::matches;
+        default:                return &MatchPolicy<TriPeaksRule>::matches;
+    }
+}
+
+/**
+ * @brief Ƿ뻨ɫйأɫ޹صĹȥɫĹ淶
+ */
+inline bool isSuitSensitive(MatchRuleType type) {
+    return type == MRT_SUIT_SEQUENCE;
+}
+
+/**
+ * @brief ؿļеĹöٻת"TriPeaks" / "Golf" / "Pyramid" / "SuitSequence"
+ */
+inline const char* getMatchRuleName(MatchRuleType type) {
+    switch (type) {
+        case MRT_GOLF:          return "Golf";
+        case MRT_PYRAMID:       return "Pyramid";
+        case MRT_SUIT_SEQUENCE: return "SuitSequence";
+        default:                return "TriPeaks";
+    }
+}
+
+inline bool parseMatchRuleName(const char* name, MatchRuleType& outType) {
+    for (int i = 0; i < MRT_NUM_RULES; i++) {
+        if (name && strcmp(name, getMatchRuleName((MatchRuleType)i)) == 0) {
+            outType = (MatchRuleType)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+#endif // __MATCH_RULES_H__
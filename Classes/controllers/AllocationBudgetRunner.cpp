@@ -0,0 +1,93 @@
+// --------------------------------------------------------
+// ļ: Classes/controllers/AllocationBudgetRunner.cpp
+// --------------------------------------------------------
+#include "AllocationBudgetRunner.h"
+#include "GameController.h"
+#include "utils/AllocationTracker.h"
+#include "utils/Logger.h"
+
+USING_NS_CC;
+
+const int AllocationBudgetRunner::kWarmupMoves;
+const int AllocationBudgetRunner::kMaxMoves;
+const int AllocationBudgetRunner::kUndoInterval;
+const int AllocationBudgetRunner::kMaxFramesPerMove;
+
+namespace {
+    enum BudgetMoveType {
+        BMT_CARD,
+        BMT_STOCK,
+        BMT_UNDO,
+        BMT_COUNT
+    };
+
+    const char* const kMoveNames[BMT_COUNT] = { "onCardClicked", "onStockClicked", "onUndoClicked" };
+
+    const float kFrameInterval = 1.0f / 60.0f;   ///< ƽõ֡
+}
+
+bool AllocationBudgetRunner::run(GameController* controller, uint64_t budget) {
+    GameView* view = controller ? controller->getGameView() : nullptr;
+    StackController* stack = controller ? controller->getStackController() : nullptr;
+    if (!view || !stack || !controller->getGameModel()) return false;
+    if (!AllocationTracker::isEnabled()) {
+        CM_LOG_WARN(LC_PERF, "AllocBudget: allocation tracking is disabled in this build");
+        return false;
+    }
+
+    // ճţ֡ƽÿһ
+    stack->setTurboMode(false);
+
+    int movesOfType[BMT_COUNT] = {};
+    uint64_t maxOfType[BMT_COUNT] = {};
+    int violations = 0;
+
+    for (int move = 0; move < kMaxMoves; move++) {
+        GameModel* model = controller->getGameModel();
+        if (model->isGameOver()) break;
+
+        // ѡһڳһʱܳƾͳƣ
+        // ƿɳұʱģжѭ˳
+        BudgetMoveType type = BMT_STOCK;
+        int cardId = model->findPlayableCard();
+        if (move % kUndoInterval == kUndoInterval - 1) {
+            type = BMT_UNDO;
+        }
+        else if (cardId >= 0) {
+            type = BMT_CARD;
+        }
+
+        AllocationScope scope;
+        switch (type) {
+        case BMT_CARD: controller->onCardClicked(cardId); break;
+        case BMT_STOCK: controller->onStockClicked(); break;
+        default: controller->onUndoClicked(); break;
+        }
+        // ƽ¡һ֡ģ¼
+        int frames = 0;
+        do {
+            view->update(kFrameInterval);
+            frames++;
+        } while ((stack->hasPendingMoves() || view->getTweens().getActiveCount() > 0) && frames < kMaxFramesPerMove);
+        uint64_t allocations = scope.getCount();
+
+        bool warmup = movesOfType[type]++ < kWarmupMoves;
+        if (!warmup && allocations > maxOfType[type]) {
+            maxOfType[type] = allocations;
+        }
+        if (!warmup && allocations > budget) {
+            violations++;
+            CM_LOG_WARN(LC_PERF, "AllocBudget: move %d %s allocated %llu times (%llu bytes), budget %llu",
+                  move, kMoveNames[type], (unsigned long long)allocations,
+                  (unsigned long long)scope.getBytes(), (unsigned long long)budget);
+        }
+    }
+
+    for (int i = 0; i < BMT_COUNT; i++) {
+        CM_LOG_INFO(LC_PERF, "AllocBudget: %s x%d, steady-state max %llu allocations",
+              kMoveNames[i], movesOfType[i], (unsigned long long)maxOfType[i]);
+    }
+    CM_LOG_INFO(LC_PERF, "AllocBudget: %s (%d violation(s), budget %llu)", violations == 0 ? "PASS" : "FAIL",
+          violations, (unsigned long long)budget);
+    return violations == 0;
+}
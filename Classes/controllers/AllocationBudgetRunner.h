@@ -0,0 +1,46 @@
+// --------------------------------------------------------
+// ļ: Classes/controllers/AllocationBudgetRunner.h
+// --------------------------------------------------------
+#ifndef __ALLOCATION_BUDGET_RUNNER_H__
+#define __ALLOCATION_BUDGET_RUNNER_H__
+
+#include <cstdint>
+
+class GameController;
+
+/**
+ * @class AllocationBudgetRunner
+ * @brief ԤԣԶһ֣̬Ķѷ
+ *
+ * ְ
+ * - ̶ԶƥȣƣÿһγֱԾֽﵽ
+ * -  AllocationScope ͳÿ onCardClicked / onStockClicked / onUndoClicked Լ֡ŵ
+ *   ж¼Ϳƻķ
+ * - ÿǰΪԤȣ״δ桢ݵȣ룬֮һԤ㼴жʧ
+ *
+ * ʹó
+ * û CARDMATCH_ALLOC_BUDGET=<ÿķ>  Debug 
+ * GameController ֡вԲ˳뱨0 ͨ1 ʧܣ
+ *
+ * ԭ
+ * - ڼرռģʽÿԹ̶֡ GameView::update
+ *   ֱжͲȫʵʻᴥα
+ * - ֻͨ GameController Ĺӿҵͬһ·
+ */
+class AllocationBudgetRunner {
+public:
+    static const int kWarmupMoves = 2;    ///< ÿԤԤȲ
+    static const int kMaxMoves = 300;     ///< 
+    static const int kUndoInterval = 5;   ///< ÿٲһγ
+    static const int kMaxFramesPerMove = 240;   ///< ÿƽ֡쳣ʱ¿
+
+    /**
+     * @brief в
+     * @param controller ѿʼϷĿ
+     * @param budget ̬ÿ
+     * @return ̬Ԥڷ true
+     */
+    static bool run(GameController* controller, uint64_t budget);
+};
+
+#endif // __ALLOCATION_BUDGET_RUNNER_H__
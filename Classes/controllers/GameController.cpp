@@ -2,11 +2,27 @@
 // ļ: Classes/controllers/GameController.cpp
 // --------------------------------------------------------
 #include "GameController.h"
+#include "controllers/AllocationBudgetRunner.h"
+#include "controllers/HistorySoakRunner.h"
+#include "controllers/ReplayParityRunner.h"
 #include "configs/LevelConfigLoader.h"
+#include "managers/AssetPreloader.h"
+#include "managers/TextureResidency.h"
 #include "services/GameModelGenerator.h"
+#include "services/GameSession.h"
 #include "services/LevelGenerator.h"
+#include "services/LevelMaterializer.h"
+#include "services/LevelSignature.h"
 #include "utils/CardHelper.h"
+#include "utils/Logger.h"
+#include "utils/StartupTimeline.h"
+#include "utils/TraceProfiler.h"
+#include "views/LoadingView.h"
+#include "views/TraceOverlayView.h"
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
 
 USING_NS_CC;
 
@@ -16,13 +32,27 @@ GameController::GameController()
     , _undoManager(nullptr)
     , _playFieldController(nullptr)
     , _stackController(nullptr)
-    , _isGameEnded(false) {}
+    , _endlessDealer(nullptr)
+    , _preloader(nullptr)
+    , _loadingView(nullptr)
+    , _firstFrameListener(nullptr)
+    , _telemetry(nullptr)
+    , _isRecordingReplay(false)
+    , _levelStartTime(0.0)
+    , _isProcessingInput(false) {}
 
 GameController::~GameController() {
+    if (_firstFrameListener) {
+        Director::getInstance()->getEventDispatcher()->removeEventListener(_firstFrameListener);
+    }
+    if (_preloader) delete _preloader;
+    if (_telemetry) delete _telemetry;
     CC_SAFE_RELEASE(_gameModel);
     CC_SAFE_RELEASE(_playFieldController);
+    if (_stackController) _stackController->setListener(nullptr);
     CC_SAFE_RELEASE(_stackController);
     if (_undoManager) delete _undoManager;
+    if (_endlessDealer) delete _endlessDealer;
 }
 
 GameController* GameController::create() {
@@ -41,22 +71,141 @@ bool GameController::init() {
     _undoManager = new UndoManager();
     _playFieldController = nullptr;
     _stackController = nullptr;
-    _isGameEnded = false;
     return true;
 }
 
 void GameController::startGame(cocos2d::Scene* scene) {
+    StartupTimeline::mark("GameController::startGame");
+
+    // ԴԤ㣺CARDMATCH_TEXTURE_BUDGET_MB=<ֽ>פǼڳ
+    auto residency = TextureResidency::getInstance();
+    const char* textureBudget = getenv("CARDMATCH_TEXTURE_BUDGET_MB");
+    if (textureBudget && textureBudget[0] != '\0') {
+        residency->setBudget((size_t)strtoul(textureBudget, nullptr, 10) * 1024 * 1024);
+    }
+    residency->pushScope("scene");
+
+    // ԾңддĿ¼µ telemetry.bin tools/telemetry_decode 룻CARDMATCH_TELEMETRY=0 ر
+    const char* telemetry = getenv("CARDMATCH_TELEMETRY");
+    if (!telemetry || telemetry[0] != '0') {
+        _telemetry = new TelemetryRecorder(FileUtils::getInstance()->getWritablePath() + "telemetry.bin");
+    }
+
+    // ·ڼؽڼ佨ãʱֻ
+    CardHelper::preloadImageKeys();
+
+    // ڹ߳Ͻ嵥еͼƬɺٴͼ֡߳Ͻ
+    _loadingView = LoadingView::create();
+    if (_loadingView) {
+        scene->addChild(_loadingView, 100);
+    }
+    _preloader = new AssetPreloader();
+    _preloader->start(AssetPreloader::loadManifest("preload.json"),
+        [this](int done, int total) {
+            if (this->_loadingView) this->_loadingView->setProgress(done, total);
+        },
+        [this, scene]() {
+            this->onPreloadFinished(scene);
+        });
+}
+
+void GameController::onPreloadFinished(cocos2d::Scene* scene) {
+    StartupTimeline::mark("preload finished");
+    if (_loadingView) {
+        _loadingView->removeFromParent();
+        _loadingView = nullptr;
+    }
+
+    auto residency = TextureResidency::getInstance();
     _gameView = GameView::create();
     if (_gameView) {
         scene->addChild(_gameView);
+        _gameView->setEventBus(&_eventBus);
         _gameView->setUndoCallback(CC_CALLBACK_0(GameController::onUndoClicked, this));
         _gameView->setStockCallback(CC_CALLBACK_0(GameController::onStockClicked, this));
         _gameView->setRestartCallback(CC_CALLBACK_0(GameController::restartGame, this));
+        _gameView->setCardTapCallback(CC_CALLBACK_1(GameController::onCardClicked, this));
+
+        // Ⱦ澲ֹʱ֡ʣ CARDMATCH_RENDER_ON_DEMAND=0 ر
+        const char* onDemand = getenv("CARDMATCH_RENDER_ON_DEMAND");
+        _gameView->setRenderOnDemand(!(onDemand && onDemand[0] == '0'));
+
+        // ̬ϳɣ CARDMATCH_BAKE_STATIC=0 ʱڵ㵥ƣڶԱ俪
+        const char* bakeStatic = getenv("CARDMATCH_BAKE_STATIC");
+        _gameView->setStaticLayerBaked(!(bakeStatic && bakeStatic[0] == '0'));
     }
 
+    residency->pushScope("level");
     generateTestLevel();
     createSubControllers();
+    configurePlayFieldMode();
     renderScene();
+    StartupTimeline::mark("first renderPlayField");
+    residency->logStats("level loaded");
+
+    // ԤԣCARDMATCH_ALLOC_BUDGET=<ÿķ>֡Զһֲ˳뱨
+    const char* allocBudget = getenv("CARDMATCH_ALLOC_BUDGET");
+    if (allocBudget && allocBudget[0] != '\0' && _gameView && _stackController) {
+        uint64_t budget = (uint64_t)strtoull(allocBudget, nullptr, 10);
+        _gameView->scheduleOnce([this, budget](float) {
+            bool passed = AllocationBudgetRunner::run(this, budget);
+            Logger::getInstance()->flush();
+            exit(passed ? 0 : 1);
+        }, 0.0f, "alloc_budget_test");
+    }
+
+    // ʷʱԣCARDMATCH_HISTORY_SOAK=<>֡ơתڴ˳뱨
+    const char* historySoak = getenv("CARDMATCH_HISTORY_SOAK");
+    if (historySoak && historySoak[0] != '\0' && _gameView && _stackController) {
+        int steps = atoi(historySoak);
+        _stackController->setTurboMode(true);
+        _gameView->scheduleOnce([this, steps](float) {
+            bool passed = HistorySoakRunner::run(this, steps);
+            Logger::getInstance()->flush();
+            exit(passed ? 0 : 1);
+        }, 0.0f, "history_soak_test");
+    }
+
+    // һԲԣCARDMATCH_REPLAY_PARITY=<>֡ÿ GameSession طŵľȶԲ˳뱨
+    const char* replayParity = getenv("CARDMATCH_REPLAY_PARITY");
+    if (replayParity && replayParity[0] != '\0' && _gameView && _stackController) {
+        int steps = atoi(replayParity);
+        _stackController->setTurboMode(true);
+        _gameView->scheduleOnce([this, steps](float) {
+            bool passed = ReplayParityRunner::run(this, steps);
+            Logger::getInstance()->flush();
+            exit(passed ? 0 : 1);
+        }, 0.0f, "replay_parity_test");
+    }
+
+    watchFirstInteractiveFrame(scene);
+}
+
+void GameController::watchFirstInteractiveFrame(cocos2d::Scene* scene) {
+    // ȾĵһλƽʱʾҴע
+    auto dispatcher = Director::getInstance()->getEventDispatcher();
+    _firstFrameListener = dispatcher->addCustomEventListener(Director::EVENT_AFTER_DRAW, [this, scene](EventCustom*) {
+        StartupTimeline::mark("first interactive frame");
+        StartupTimeline::report();
+
+        Director::getInstance()->getEventDispatcher()->removeEventListener(this->_firstFrameListener);
+        this->_firstFrameListener = nullptr;
+        this->completeDeferredSetup(scene);
+    });
+}
+
+void GameController::completeDeferredSetup(cocos2d::Scene* scene) {
+    // ֡ҪĽ֮֡󴴽Ϸ汾ڽʱŴ
+    if (_gameView) {
+        _gameView->completeDeferredSetup();
+    }
+
+#if CM_ENABLE_TRACE
+    auto traceOverlay = TraceOverlayView::create();
+    if (traceOverlay) {
+        scene->addChild(traceOverlay, 1000);
+    }
+#endif
 }
 
 void GameController::createSubControllers() {
@@ -68,29 +217,126 @@ void GameController::createSubControllers() {
 
     if (_playFieldController) {
         _playFieldController->retain();
-        _playFieldController->setCardClickHandler(CC_CALLBACK_1(GameController::onCardClicked, this));
     }
     if (_stackController) {
         _stackController->retain();
+        _stackController->setListener(this);
+
+        // û CARDMATCH_TURBO رжԶ
+        const char* turbo = getenv("CARDMATCH_TURBO");
+        _stackController->setTurboMode(turbo && turbo[0] != '\0' && turbo[0] != '0');
     }
 }
 
+void GameController::configurePlayFieldMode() {
+    bool endless = (_endlessDealer != nullptr);
+    if (_playFieldController) {
+        _playFieldController->setVirtualized(endless);
+    }
+    if (!_gameView) return;
+
+    _gameView->setScrollEnabled(endless);
+    if (endless) {
+        _gameView->setPlayFieldSyncCallback([this](bool playFieldChanged) {
+            if (this->_playFieldController) this->_playFieldController->syncVisibleCards(playFieldChanged);
+        });
+    }
+    else {
+        _gameView->setPlayFieldSyncCallback(nullptr);
+    }
+}
+
+bool GameController::readEndlessSeed(uint64_t& seed) {
+    const char* seedText = getenv("CARDMATCH_ENDLESS");
+    if (!seedText || seedText[0] == '\0') return false;
+
+    if (!LevelMaterializer::parseSeed(seedText, seed)) {
+        seed = (uint64_t)time(nullptr);
+    }
+    return true;
+}
+
+bool GameController::loadSeededLevel(LevelConfig& config, uint64_t& seed) {
+    const char* seedText = getenv("CARDMATCH_SEED");
+    if (!seedText || seedText[0] == '\0') return false;
+
+    if (strncmp(seedText, "pack:", 5) == 0) {
+        std::vector<LevelPackEntry> pack = LevelConfigLoader::loadLevelPack("levels/pack1.json");
+        int index = atoi(seedText + 5);
+        if (index < 0 || index >= (int)pack.size()) {
+            CM_LOG_WARN(LC_GAME, "CARDMATCH_SEED: pack index %d out of range (%d levels)", index, (int)pack.size());
+            return false;
+        }
+        seed = pack[index].seed;
+    }
+    else if (!LevelMaterializer::parseSeed(seedText, seed)) {
+        CM_LOG_WARN(LC_GAME, "CARDMATCH_SEED: invalid seed '%s'", seedText);
+        return false;
+    }
+
+    config = LevelGenerator::generateFromSeed(seed);
+    CM_LOG_INFO(LC_GAME, "Seeded level %s (%s)", LevelMaterializer::formatSeed(seed).c_str(),
+          LevelMaterializer::getLayoutName(LevelMaterializer::getLayout(seed)));
+    return !config.playfieldCards.empty();
+}
+
 void GameController::generateTestLevel() {
+    CM_TRACE_SCOPE("GameController::loadLevel");
     CC_SAFE_RELEASE(_gameModel);
     
     _gameModel = GameModel::create();
     if (!_gameModel) return;
     _gameModel->retain();
 
-    LevelConfig config = LevelConfigLoader::loadLevelConfig("level1.json");
+    // ޾ģʽɷƷ貹Ⱥ͵ƶѳȶй̶
+    uint64_t endlessSeed = 0;
+    if (readEndlessSeed(endlessSeed)) {
+        if (!_endlessDealer) _endlessDealer = new EndlessDealer();
+        _endlessDealer->start(_gameModel, endlessSeed, UndoManager::getReservedBytes(0, EndlessDealer::kUndoDepth));
+        CM_LOG_INFO(LC_GAME, "Endless mode, seed %s", LevelMaterializer::formatSeed(endlessSeed).c_str());
+
+        if (_undoManager) {
+            _undoManager->reset(_gameModel->getArena(), EndlessDealer::kUndoDepth, false);
+        }
+        _gameModel->setEventBus(&_eventBus);
+        _levelConfig = LevelConfig();
+        _isRecordingReplay = false;
+        recordTelemetry(TET_LEVEL_START, (uint32_t)endlessSeed);
+        return;
+    }
+
+    LevelConfig config;
+    uint64_t seed = 0;
+    if (!loadSeededLevel(config, seed)) {
+        seed = 0;
+        config = LevelConfigLoader::loadLevelConfig("level1.json");
+    }
 
     if (config.playfieldCards.empty()) {
-        CCLOG("Config empty. Using default pyramid layout.");
+        CM_LOG_WARN(LC_GAME, "Config empty. Using default pyramid layout.");
         config = LevelGenerator::generateDefaultPyramid();  
     }
 
-    GameModelGenerator::generate(_gameModel, config);
+    // ʷ뿨ƹñֵڴؿʱɾͷ
+    int cardCount = (int)(config.playfieldCards.size() + config.stackCards.size());
+    GameModelGenerator::generate(_gameModel, config, UndoManager::getReservedBytes(cardCount, 0));
     _gameModel->refreshCardStates();
+    _levelConfig = config;
+
+    if (_undoManager) {
+        _undoManager->reset(_gameModel->getArena(), 0, true);
+    }
+
+    // ɽ׶ε״̬ renderScene ȫȾ֮޸Ĳͨ¼֪ͨͼ
+    _gameModel->setEventBus(&_eventBus);
+
+    // ؿʶȡɫĹؿǩͬһؿڲͬ豸һ£طŰƥؿ
+    uint64_t levelHash = LevelSignature::compute(config, true);
+    _replay.begin(levelHash, seed, config.matchRule);
+    _replay.reserve(kReplayReserveMoves);
+    _isRecordingReplay = true;
+    _levelStartTime = utils::gettime();
+    recordTelemetry(TET_LEVEL_START, (uint32_t)levelHash);
 }
 
 void GameController::renderScene() {
@@ -112,27 +358,24 @@ void GameController::refreshViewStates() {
     }
 }
 
-void GameController::checkGameState() {
-    if (_isGameEnded) return;
+void GameController::restartGame() {
+    CM_LOG_INFO(LC_GAME, "Restarting game...");
 
-    if (_gameModel->isGameWon()) {
-        _isGameEnded = true;
-        CCLOG("GAME WON!");
-        _gameView->showGameOverUI(true);
-    }
-    else if (_gameModel->isGameLost()) {
-        _isGameEnded = true;
-        CCLOG("GAME LOST - NO MOVES!");
-        _gameView->showGameOverUI(false);
+    // ɾֲĶֱӽδִе
+    if (_stackController) {
+        _stackController->finishPendingMoves();
     }
-}
+    _inputQueue.clear();
+    _eventBus.clear();
 
-void GameController::restartGame() {
-    CCLOG("Restarting game...");
-    
-    _isGameEnded = false;
     _undoManager->clear();
-    
+    flushTelemetry();
+
+    // ɹؿͷţ¹ؿȾٰԤʹõ
+    auto residency = TextureResidency::getInstance();
+    residency->popScope();
+    residency->pushScope("level");
+
     generateTestLevel();
     
     if (_playFieldController) {
@@ -143,111 +386,258 @@ void GameController::restartGame() {
     }
     
     renderScene();
+    residency->trim();
+    residency->logStats("level switched");
 }
 
-void GameController::onCardClicked(CardView* clickedView) {
-    if (_isGameEnded) return;
-    if (!clickedView || !clickedView->getCardModel()) return;
-    if (clickedView->getNumberOfRunningActions() > 0) return;
+void GameController::onCardClicked(int cardId) {
+    CM_TRACE_SCOPE("GameController::onCardClicked");
+    if (cardId < 0) return;
 
-    CardModel* clickedCard = clickedView->getCardModel();
-    if (!clickedCard->isFaceUp()) return;
-
-    CardModel* topStackCard = _gameModel->getTopStackCard();
-    if (!topStackCard) return;
+    InputCommand command;
+    command.type = ICT_CARD_TAP;
+    command.cardId = cardId;
+    enqueueCommand(command);
+}
 
-    if (isCardMatchable(clickedCard, topStackCard)) {
-        handleMatchedCard(clickedCard, clickedView);
+void GameController::enqueueCommand(const InputCommand& command) {
+    if (!_gameModel || _gameModel->isGameOver()) return;
+    if (!_inputQueue.push(command)) {
+        CM_LOG_WARN(LC_INPUT, "Input queue full, command dropped");
+        return;
     }
-    else {
-        playMismatchAnimation(clickedView);
+    processInputQueue();
+}
+
+void GameController::processInputQueue() {
+    // ɻصпٴδ룬ѭͳһ
+    if (_isProcessingInput) return;
+    _isProcessingInput = true;
+
+    InputCommand command;
+    while (_inputQueue.pop(command)) {
+        // ͼ׷ģͣһĶֱյ㣬ģ״̬
+        if (_stackController && _stackController->hasPendingMoves()) {
+            _stackController->finishPendingMoves();
+        }
+        if (_gameView) {
+            _gameView->flushEvents();
+        }
+        if (_endlessDealer && _endlessDealer->needsRebase()) {
+            rebaseEndlessField();
+        }
+        if (_gameModel->isGameOver()) {
+            _inputQueue.clear();
+            break;
+        }
+
+        switch (command.type) {
+        case ICT_CARD_TAP: executeCardTap(command.cardId); break;
+        case ICT_STOCK_TAP: executeStockTap(); break;
+        case ICT_UNDO: executeUndo(); break;
+        case ICT_HISTORY_JUMP: executeHistoryJump(command.cardId); break;
+        }
     }
+
+    _isProcessingInput = false;
 }
 
-bool GameController::isCardMatchable(CardModel* card1, CardModel* card2) {
-    int v1 = (int)card1->getFace();
-    int v2 = (int)card2->getFace();
-    return (std::abs(v1 - v2) == 1) || (v1 == 1 && v2 == 13) || (v1 == 13 && v2 == 1);
+void GameController::rebaseEndlessField() {
+    CM_TRACE_SCOPE("GameController::rebaseEndlessField");
+    Vec2 delta = _endlessDealer->rebase(_gameModel);
+    if (delta.isZero()) return;
+
+    _undoManager->shiftPositions(delta);
+    if (_gameView) {
+        _gameView->shiftPlayField(delta);
+    }
+    // ѱգƽƺλµǼ
+    refreshViewStates();
 }
 
-void GameController::handleMatchedCard(CardModel* clickedCard, CardView* clickedView) {
-    // ƶ֮ǰ¼ɵ
-    CardModel* oldTopCard = _gameModel->getTopStackCard();
-    if (oldTopCard) oldTopCard->retain();
-    
-    // ¼
-    _undoManager->pushStep(clickedCard, clickedView->getPosition(), oldTopCard, false);
+void GameController::executeCardTap(int cardId) {
+    CardModel* clickedCard = _gameModel->getPlayFieldCardById(cardId);
+    if (!clickedCard || !clickedCard->isFaceUp()) return;
+
+    CardView* clickedView = findPlayFieldCardView(clickedCard);
+    if (!clickedView) return;
+
+    // ģͬύʱЧ¼ģͱֲ
+    MoveRecord record = _gameModel->applyPlayFieldMove(clickedCard);
+    if (!record.isValid()) {
+        recordTelemetry(TET_MISMATCH, (uint32_t)cardId);
+        playMismatchAnimation(clickedView);
+        return;
+    }
+
+    _undoManager->pushRecord(record);
+    recordMove(TET_CARD_TAP, cardId);
 
     if (_stackController) {
-        _stackController->moveCardToStack(clickedCard, clickedView->getPosition(), 
-            [this, oldTopCard]() {
-                if (oldTopCard) oldTopCard->release();
-                this->_gameModel->refreshCardStates();
-                this->refreshViewStates();
-                this->checkGameState();
-            });
+        _stackController->playMoveToStack(record);
     }
 }
 
+CardView* GameController::findPlayFieldCardView(CardModel* card) {
+    auto layer = _gameView ? _gameView->getPlayFieldLayer() : nullptr;
+    if (!layer) return nullptr;
+
+    for (auto node : layer->getChildren()) {
+        auto view = dynamic_cast<CardView*>(node);
+        if (view && view->getCardModel() == card) return view;
+    }
+    return nullptr;
+}
+
 void GameController::playMismatchAnimation(CardView* cardView) {
-    cardView->runAction(Sequence::create(
-        MoveBy::create(0.05f, Vec2(10, 0)),
-        MoveBy::create(0.05f, Vec2(-20, 0)),
-        MoveBy::create(0.05f, Vec2(10, 0)), nullptr));
+    if (_stackController && _stackController->isTurboMode()) return;
+
+    // ʱһζλƫۻ
+    TweenManager& tweens = _gameView->getTweens();
+    Vec2 origin = cardView->getCardModel()->getPosition();
+    tweens.cancel(cardView);
+    cardView->setPosition(origin);
+
+    int tweenId = tweens.moveTo(cardView, origin + Vec2(10, 0), 0.05f);
+    tweenId = tweens.then(tweenId, origin - Vec2(10, 0), 0.05f);
+    tweens.then(tweenId, origin, 0.05f);
 }
 
 void GameController::onStockClicked() {
-    if (_isGameEnded) return;
-    if (!_gameModel || _gameModel->getStockCount() <= 0) return;
+    CM_TRACE_SCOPE("GameController::onStockClicked");
+    InputCommand command;
+    command.type = ICT_STOCK_TAP;
+    command.cardId = -1;
+    enqueueCommand(command);
+}
+
+void GameController::executeStockTap() {
+    if (!_gameModel) return;
 
-    CardModel* oldTopCard = _gameModel->getTopStackCard();
-    if (oldTopCard) oldTopCard->retain();
+    MoveRecord record = _gameModel->applyStockDraw();
+    if (!record.isValid()) return;
+
+    _undoManager->pushRecord(record);
+    recordMove(TET_STOCK_DRAW, SMC_DRAW);
 
     if (_stackController) {
-        _stackController->drawCardFromStock([this, oldTopCard](CardModel* drawnCard) {
-            if (drawnCard) {
-                // ʹóǰľɵ
-                _undoManager->pushStep(drawnCard, Vec2::ZERO, oldTopCard, true);
-                this->checkGameState();
-            }
-            if (oldTopCard) oldTopCard->release();
-        });
+        _stackController->playStockDraw(record);
     }
 }
 
 void GameController::onUndoClicked() {
-    if (_isGameEnded) return;
+    CM_TRACE_SCOPE("GameController::onUndoClicked");
+    InputCommand command;
+    command.type = ICT_UNDO;
+    command.cardId = -1;
+    enqueueCommand(command);
+}
+
+void GameController::executeUndo() {
+    MoveRecord record;
+    if (!_undoManager->stepBack(record)) return;
 
-    UndoStep step;
-    if (!_undoManager->popStep(step)) return;
+    MoveRecord inverse = _gameModel->undoMove(record);
+    if (!inverse.isValid()) return;
+    recordMove(TET_UNDO, SMC_UNDO);
 
-    _gameModel->setTopStackCard(step.previousTopCard);
     if (_stackController) {
-        _stackController->updateStackView();
+        _stackController->playUndo(inverse);
     }
+}
+
+void GameController::onUndoFlightLanded(CardView* cardView) {
+    // ɻϷĿͼɶ½ºǼǵ
+    if (!_playFieldController) return;
+    _playFieldController->bindCardView(cardView);
+    // ޾ģʽĿƿڵǰΧ֮
+    if (_endlessDealer) _playFieldController->syncVisibleCards(true);
+}
 
-    if (step.isFromStock) {
-        handleUndoFromStock(step);
+void GameController::onHistoryJump(int nodeId) {
+    CM_TRACE_SCOPE("GameController::onHistoryJump");
+    InputCommand command;
+    command.type = ICT_HISTORY_JUMP;
+    command.cardId = nodeId;
+    enqueueCommand(command);
+}
+
+void GameController::executeHistoryJump(int nodeId) {
+    if (!_undoManager->isBranching()) return;
+    const UndoNode* target = _undoManager->findNode(nodeId);
+    if (!target || target == _undoManager->getCurrent()) return;
+
+    // ˻عͬ
+    MoveRecord record;
+    while (!UndoManager::isAncestorOf(_undoManager->getCurrent(), target)) {
+        if (!_undoManager->stepBack(record) || !_gameModel->undoMove(record).isValid()) break;
+        recordMove(TET_UNDO, SMC_UNDO);
     }
-    else {
-        handleUndoFromPlayField(step);
+
+    // Ŀ֧ڵֻ¼ƶĿƣģͰڵ
+    while (const UndoNode* next = _undoManager->getNextStepToward(target)) {
+        bool isCardMove = (next->type == MT_PLAYFIELD_TO_STACK);
+        int cardId = next->card->getId();
+        record = isCardMove ? _gameModel->applyPlayFieldMove(next->card) : _gameModel->applyStockDraw();
+        if (!record.isValid()) break;
+
+        _undoManager->pushRecord(record);
+        if (isCardMove) recordMove(TET_CARD_TAP, cardId);
+        else recordMove(TET_STOCK_DRAW, SMC_DRAW);
+    }
+
+    if (_undoManager->getCurrent() != target) {
+        CM_LOG_WARN(LC_GAME, "History jump to node %d stopped at node %d", nodeId, _undoManager->getCurrent()->id);
     }
 
-    CC_SAFE_RELEASE(step.movedCard);
-    CC_SAFE_RELEASE(step.previousTopCard);
+    // м䲽費Ŷ𲽵¼ȫȾ
+    _eventBus.clear();
+    renderScene();
 }
 
-void GameController::handleUndoFromStock(const UndoStep& step) {
-    if (_stackController) {
-        _stackController->undoDrawCard(step.movedCard);
+void GameController::recordTelemetry(TelemetryEventType type, uint32_t value) {
+    if (!_telemetry || !_gameModel) return;
+
+    int cardsRemaining = (int)_gameModel->getPlayFieldCards().size();
+    int stockCount = _gameModel->getStockCount();
+    _telemetry->record(type, value, cardsRemaining, stockCount);
+}
+
+void GameController::recordMove(TelemetryEventType type, int move) {
+    if (_isRecordingReplay) {
+        _replay.addMove(move, (uint32_t)((utils::gettime() - _levelStartTime) * 1000.0));
+    }
+    recordTelemetry(type, move >= 0 ? (uint32_t)move : 0);
+
+    if (_gameModel->isGameOver()) {
+        onGameFinished();
     }
 }
 
-void GameController::handleUndoFromPlayField(const UndoStep& step) {
-    if (_stackController) {
-        _stackController->undoMoveToStack(step.movedCard, step.originalPos, [this]() {
-            this->_gameModel->refreshCardStates();
-            this->refreshViewStates();
-        });
+void GameController::onGameFinished() {
+    recordTelemetry(TET_GAME_OVER, _gameModel->isGameWon() ? 1 : 0);
+    flushTelemetry();
+    CM_LOG_INFO(LC_GAME, "Undo history: %d nodes, %u bytes", _undoManager->getNodeCount(),
+                (unsigned)_undoManager->getNodeBytes());
+
+    if (!_isRecordingReplay) return;
+    _isRecordingReplay = false;
+
+    std::vector<uint8_t> data;
+    _replay.finish(data);
+    std::string path = FileUtils::getInstance()->getWritablePath() + "last_replay.cmr";
+    FILE* file = fopen(path.c_str(), "wb");
+    if (!file || fwrite(data.data(), data.size(), 1, file) != 1) {
+        CM_LOG_WARN(LC_GAME, "Cannot save replay to %s", path);
+    }
+    else {
+        CM_LOG_INFO(LC_GAME, "Replay saved: %u moves in %u bytes", _replay.getMoveCount(), (unsigned)data.size());
     }
-}
\ No newline at end of file
+    if (file) fclose(file);
+}
+
+void GameController::flushTelemetry() {
+    if (!_telemetry) return;
+    _telemetry->flush();
+    _telemetry->logStats();
+}
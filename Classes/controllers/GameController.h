@@ -9,9 +9,17 @@
 #include "views/GameView.h"
 #include "views/CardView.h"
 #include "managers/UndoManager.h"
+#include "managers/InputCommandQueue.h"
+#include "managers/GameEventBus.h"
+#include "managers/TelemetryRecorder.h"
 #include "controllers/PlayFieldController.h"
 #include "controllers/StackController.h"
 #include "configs/LevelConfig.h"
+#include "services/EndlessDealer.h"
+#include "services/ReplayCodec.h"
+
+class AssetPreloader;
+class LoadingView;
 
 /**
  * @class GameController
@@ -19,15 +27,17 @@
  * 
  * ְ
  * - Э GameModel  GameView ֮Ľ
- * - û루ơ¿ʼ
+ * - û루ơ¿ʼִٰ
  * - ӿPlayFieldControllerStackController
- * - ϵͳUndoManager
+ * - ϵͳUndoManagerתʷеһ
+ * - ģ͵ͼ¼ߣGameEventBusģͷGameView ÿ֡
  * - Ϸ̣ʼ
+ * - ޾ģʽ³ EndlessDealerֵʱؾģ͡¼ͼ
  * 
  * ڣ
  *  HelloWorldScene УᴩϷ
  */
-class GameController : public cocos2d::Ref {
+class GameController : public cocos2d::Ref, public StackControllerListener {
 public:
     GameController();
     ~GameController();
@@ -47,14 +57,15 @@ public:
     /**
      * @brief ʼϷ
      * @param scene ϷView ӵ˳
+     * @details ʾԤԤɺ󴴽ͼ͹ؿ
      */
     void startGame(cocos2d::Scene* scene);
     
     /**
      * @brief Ƶ¼
-     * @param cardView Ŀͼ
+     * @param cardId Ŀ ID GameView Ĵ·ɷַ
      */
-    void onCardClicked(CardView* cardView);
+    void onCardClicked(int cardId);
     
     /**
      * @brief Ƶ¼
@@ -66,77 +77,205 @@ public:
      */
     void onUndoClicked();
     
+    /**
+     * @brief תʷеĳ棨һ֧
+     * @param nodeId ĿڵĴţUndoNode::id
+     * @details ޾ģʽ֧תЧ
+     */
+    void onHistoryJump(int nodeId);
+
     /**
      * @brief ¿ʼϷ
      */
     void restartGame();
 
+    /**
+     * @brief ȡǰԾֵģͣԶԶȡ棩
+     */
+    GameModel* getGameModel() const { return _gameModel; }
+
+    /**
+     * @brief ȡʷԹѡתĿͳڴ棩
+     */
+    const UndoManager* getUndoManager() const { return _undoManager; }
+
+    /**
+     * @brief ȡϷͼͳƶѿԹ֡ƽ
+     */
+    GameView* getGameView() const { return _gameView; }
+    StackController* getStackController() const { return _stackController; }
+
+    /**
+     * @brief ȡǰؿãԹ GameSession طͬһؿ޾ģʽΪã
+     */
+    const LevelConfig& getLevelConfig() const { return _levelConfig; }
+
+    /**
+     * @brief ɻصĿ£ǼǵStackControllerListener
+     * @param cardView ͼ
+     */
+    void onUndoFlightLanded(CardView* cardView) override;
+
+    /**
+     * @brief дδ̵ң¼е̨ʱã
+     */
+    void flushTelemetry();
+
 private:
+    static const int kReplayReserveMoves = 512;   ///< طԤĲ¼ƹв
+
+    /**
+     * @brief Ӳ
+     * @param command 
+     */
+    void enqueueCommand(const InputCommand& command);
+
+    /**
+     * @brief ˳ִже
+     * @details ִǰȿδɵĶ֤ÿµģ״̬
+     */
+    void processInputQueue();
+
+    /**
+     * @brief ִпƵ
+     * @param cardId Ŀ ID
+     */
+    void executeCardTap(int cardId);
+
+    /**
+     * @brief ִбƵ
+     */
+    void executeStockTap();
+
+    /**
+     * @brief ִг
+     */
+    void executeUndo();
+
+    /**
+     * @brief ִʷת
+     * @param nodeId ĿڵĴ
+     * @details 𲽳Ŀ뵱ǰĹͬȣĿ֧ȫˢͼ
+     *          ÿһճطźң⣬طԵĲ
+     */
+    void executeHistoryJump(int nodeId);
+
+    /**
+     * @brief ϷпƶӦͼ
+     * @param card ģ
+     * @return ͼڷ nullptr
+     */
+    CardView* findPlayFieldCardView(CardModel* card);
+
+    /**
+     * @brief Ԥɣ GameViewɲȾؿ
+     * @param scene Ϸ
+     */
+    void onPreloadFinished(cocos2d::Scene* scene);
+
+    /**
+     * @brief ڵһλƳ̺ʱӺĳʼ
+     * @param scene Ϸ
+     */
+    void watchFirstInteractiveFrame(cocos2d::Scene* scene);
+
+    /**
+     * @brief ׸ɽ֮֡󴴽ǹؼĽ棨ť̬ؽDebug ͳƸ㣩
+     * @param scene Ϸ
+     */
+    void completeDeferredSetup(cocos2d::Scene* scene);
+
     /**
      * @brief ɲԹؿ
-     * @details ԼļʧʱʹĬϽ
+     * @details ʹ CARDMATCH_SEED ָӹؿμļʧʱʹĬϽ
      */
     void generateTestLevel();
-    
+
     /**
-     * @brief ӿ
+     * @brief  CARDMATCH_SEED ԭӹؿ
+     * @param config Ĺؿ
+     * @param seed 
+     * @return ˿ʶʱ true
+     * @details ȡֵΪʮӣÿսӣ "pack:<>" ʾؿеĵڼؿ
      */
-    void createSubControllers();
+    bool loadSeededLevel(LevelConfig& config, uint64_t& seed);
     
     /**
-     * @brief Ⱦ
+     * @brief  CARDMATCH_ENDLESS ȡ޾ģʽ
+     * @param seed 
+     * @return  CARDMATCH_ENDLESS ʱ true
+     * @details ȡֵΪʮӣ޷ʱ "on"ʹõǰʱ
      */
-    void renderScene();
+    bool readEndlessSeed(uint64_t& seed);
 
     /**
-     * @brief ˢ¿ͼ״̬
+     * @brief ޾ģʽؾƽģ͡¼Ϸͼ
+     * @details ִ֮УʱûδɵĶ
      */
-    void refreshViewStates();
+    void rebaseEndlessField();
 
     /**
-     * @brief Ϸ״̬ʤ/ʧܣ
+     * @brief ǰģʽϷͼ⻯
      */
-    void checkGameState();
-    
+    void configurePlayFieldMode();
+
     /**
-     * @brief жǷƥ
-     * @param card1 һ
-     * @param card2 ڶ
-     * @return ƥ䷵ true
+     * @brief ӿ
      */
-    bool isCardMatchable(CardModel* card1, CardModel* card2);
+    void createSubControllers();
     
     /**
-     * @brief ƥɹĿ
-     * @param clickedCard Ŀģ
-     * @param clickedView Ŀͼ
+     * @brief Ⱦ
      */
-    void handleMatchedCard(CardModel* clickedCard, CardView* clickedView);
-    
+    void renderScene();
+
+    /**
+     * @brief ˢ¿ͼ״̬
+     */
+    void refreshViewStates();
+
     /**
      * @brief ŲƥĶ
      * @param cardView ҪĿͼ
      */
     void playMismatchAnimation(CardView* cardView);
-    
+
     /**
-     * @brief ӱƶѵĳ
-     * @param step 
+     * @brief ¼һң¼ǰϷʣ࿨ͱƶ
+     * @param type ¼
+     * @param value ¼Ͷֵ
      */
-    void handleUndoFromStock(const UndoStep& step);
-    
+    void recordTelemetry(TelemetryEventType type, uint32_t value);
+
     /**
-     * @brief Ϸĳ
-     * @param step 
+     * @brief ¼һִеĲ׷ӵطŲ¼ң⣬Ծ˽ʱ onGameFinished
+     * @param type ң¼
+     * @param move Ϸ ID SMC_DRAW / SMC_UNDO
      */
-    void handleUndoFromPlayField(const UndoStep& step);
+    void recordMove(TelemetryEventType type, int move);
 
+    /**
+     * @brief Ծֽ¼¼дң⣬ѱֻطű浽дĿ¼µ last_replay.cmr
+     */
+    void onGameFinished();
+    
     GameModel* _gameModel;                      ///< Ϸģ
     GameView* _gameView;                        ///< Ϸͼ
     UndoManager* _undoManager;                  ///< 
     PlayFieldController* _playFieldController;  ///< Ϸ
     StackController* _stackController;          ///< ƶѿ
-    bool _isGameEnded;                          ///< ϷǷѽ
+    EndlessDealer* _endlessDealer;              ///< ޾ģʽƷͨؿΪ nullptr
+    LevelConfig _levelConfig;                   ///< ǰؿã޾ģʽΪ
+    AssetPreloader* _preloader;                 ///< Ԥ
+    LoadingView* _loadingView;                  ///< ԤڼĽɺΪ nullptr
+    cocos2d::EventListenerCustom* _firstFrameListener;  ///< ׸ɽ֡ĻƼ
+    TelemetryRecorder* _telemetry;              ///< Ծң⣬رʱΪ nullptr
+    ReplayWriter _replay;                       ///< ֻط
+    bool _isRecordingReplay;                    ///< Ƿ¼ƻطţ޾ģʽ¼ƣ
+    double _levelStartTime;                     ///< ֿʼʱ䣨룩طʱ
+    InputCommandQueue _inputQueue;              ///< ִе
+    GameEventBus _eventBus;                     ///< ģ͵ͼ¼
+    bool _isProcessingInput;                    ///< ǷִУֹص룩
 };
 
 #endif
\ No newline at end of file
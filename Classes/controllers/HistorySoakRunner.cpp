@@ -0,0 +1,109 @@
+// --------------------------------------------------------
+// ļ: Classes/controllers/HistorySoakRunner.cpp
+// --------------------------------------------------------
+#include "HistorySoakRunner.h"
+#include "GameController.h"
+#include "utils/Logger.h"
+#include <random>
+
+USING_NS_CC;
+
+const int HistorySoakRunner::kReportCount;
+const int HistorySoakRunner::kUndoPercent;
+const int HistorySoakRunner::kJumpPercent;
+const unsigned HistorySoakRunner::kSeed;
+
+namespace {
+    /**
+     * @brief ѡתĿ꣺ӵǰڵɲӽڵ½ɲ
+     */
+    const UndoNode* pickJumpTarget(const UndoManager* history, std::mt19937& random) {
+        const UndoNode* node = history->getCurrent();
+        int span = node->depth - history->getRoot()->depth;
+        int up = span > 0 ? (int)(random() % (span + 1)) : 0;
+        for (int i = 0; i < up; i++) node = node->parent;
+
+        int down = (int)(random() % (up + 1));
+        for (int i = 0; i < down && node->firstChild; i++) {
+            int childCount = 0;
+            for (const UndoNode* child = node->firstChild; child; child = child->nextSibling) childCount++;
+
+            int pick = (int)(random() % childCount);
+            node = node->firstChild;
+            while (pick-- > 0) node = node->nextSibling;
+        }
+        return node;
+    }
+}
+
+bool HistorySoakRunner::run(GameController* controller, int steps) {
+    const UndoManager* history = controller ? controller->getUndoManager() : nullptr;
+    if (!history || !controller->getGameModel() || steps <= 0) return false;
+    if (!history->isBranching()) {
+        CM_LOG_WARN(LC_PERF, "HistorySoak: history branching is disabled in endless mode");
+        return false;
+    }
+
+    ModelArena* arena = controller->getGameModel()->getArena();
+    size_t arenaStart = arena ? arena->getUsedBytes() : 0;
+    std::mt19937 random(kSeed);
+    int reportInterval = steps / kReportCount > 0 ? steps / kReportCount : 1;
+    int forwards = 0;
+    int undos = 0;
+    int jumps = 0;
+    int mismatches = 0;
+    int step = 0;
+
+    for (; step < steps; step++) {
+        GameModel* model = controller->getGameModel();
+        if (model->isGameOver()) {
+            CM_LOG_WARN(LC_PERF, "HistorySoak: game over at step %d", step);
+            break;
+        }
+
+        // һ֮󶼲ϷľȫƣԾֲ
+        bool canAdvance = model->getStockCount() >= 2 && model->getPlayFieldCards().size() >= 2;
+        int roll = (int)(random() % 100);
+        if (roll < kJumpPercent) {
+            const UndoNode* target = pickJumpTarget(history, random);
+            controller->onHistoryJump(target->id);
+            jumps++;
+
+            bool reached = history->getCurrent() == target;
+            bool consistent = target == history->getRoot()
+                || (model->getTopStackCard() == target->card && model->getStockCount() == target->stockCount);
+            if (!reached || !consistent) {
+                mismatches++;
+                CM_LOG_WARN(LC_PERF, "HistorySoak: step %d jump to node %d %s", step, target->id,
+                            reached ? "left an inconsistent model" : "did not arrive");
+            }
+        }
+        else if (roll < kJumpPercent + kUndoPercent || !canAdvance) {
+            if (history->isEmpty()) {
+                CM_LOG_WARN(LC_PERF, "HistorySoak: level has too few cards to keep playing");
+                break;
+            }
+            controller->onUndoClicked();
+            undos++;
+        }
+        else {
+            int cardId = model->findPlayableCard();
+            if (cardId >= 0) controller->onCardClicked(cardId);
+            else controller->onStockClicked();
+            forwards++;
+        }
+
+        if ((step + 1) % reportInterval == 0) {
+            size_t arenaGrowth = arena ? arena->getUsedBytes() - arenaStart : 0;
+            CM_LOG_INFO(LC_PERF, "HistorySoak: step %d, %d nodes, %u node bytes (%.1f bytes/step), arena +%u bytes",
+                        step + 1, history->getNodeCount(), (unsigned)history->getNodeBytes(),
+                        (double)history->getNodeBytes() / (step + 1), (unsigned)arenaGrowth);
+        }
+    }
+
+    CM_LOG_INFO(LC_PERF, "HistorySoak: %d steps (%d forward, %d undo, %d jump), %d nodes of %u bytes, depth %d",
+                step, forwards, undos, jumps, history->getNodeCount(), (unsigned)sizeof(UndoNode),
+                history->getCurrent()->depth);
+    CM_LOG_INFO(LC_PERF, "HistorySoak: %s (%d mismatch(es))", mismatches == 0 ? "PASS" : "FAIL", mismatches);
+    return mismatches == 0 && step == steps;
+}
@@ -0,0 +1,43 @@
+// --------------------------------------------------------
+// ļ: Classes/controllers/HistorySoakRunner.h
+// --------------------------------------------------------
+#ifndef __HISTORY_SOAK_RUNNER_H__
+#define __HISTORY_SOAK_RUNNER_H__
+
+class GameController;
+
+/**
+ * @class HistorySoakRunner
+ * @brief ʷʱԣʱơתʷڴ
+ *
+ * ְ
+ * - ̶ѡһƻơһľ֧
+ * - ÿת˶ģ;棨ơĿڵ¼һ
+ * - ڵڵڴ桢ؿڴÿƽ
+ *
+ * ʹó
+ * û CARDMATCH_HISTORY_SOAK=<> Ϸ
+ * GameController ֡вԲ˳뱨0 ͨ1 ʧܣ
+ *
+ * ԭ
+ * - ڼǿƼģʽÿڵ÷ǰ
+ * - ֻڱƺϷʣʱǰԾֲԿһֱȥ
+ * - ֻͨ GameController ĹӿҲͬһ·
+ */
+class HistorySoakRunner {
+public:
+    static const int kReportCount = 10;    ///< ͳƵĴ
+    static const int kUndoPercent = 25;    ///< һĸʣ%
+    static const int kJumpPercent = 10;    ///< תĸʣ%
+    static const unsigned kSeed = 20261019;   ///< ӣͬһؿĽɸ
+
+    /**
+     * @brief в
+     * @param controller ѿʼϷĿͨؿ
+     * @param steps ܲ
+     * @return תĿҾһ· true
+     */
+    static bool run(GameController* controller, int steps);
+};
+
+#endif // __HISTORY_SOAK_RUNNER_H__
@@ -1,10 +1,13 @@
 #include "PlayFieldController.h"
+#include "utils/TraceProfiler.h"
+#include <cfloat>
 
 USING_NS_CC;
 
 PlayFieldController::PlayFieldController()
     : _gameModel(nullptr)
-    , _gameView(nullptr) {
+    , _gameView(nullptr)
+    , _isVirtualized(false) {
 }
 
 PlayFieldController::~PlayFieldController() {
@@ -34,37 +37,86 @@ bool PlayFieldController::init(GameModel* gameModel, GameView* gameView) {
     return true;
 }
 
-void PlayFieldController::setCardClickHandler(const std::function<void(CardView*)>& handler) {
-    _cardClickHandler = handler;
-}
-
 void PlayFieldController::renderPlayField() {
+    CM_TRACE_SCOPE("PlayFieldController::renderPlayField");
     if (!_gameView || !_gameModel) return;
 
     auto playFieldLayer = _gameView->getPlayFieldLayer();
     if (!playFieldLayer) return;
 
-    playFieldLayer->removeAllChildren();
+    // ͼŻͼأؿʱ´
+    auto children = playFieldLayer->getChildren();
+    for (auto node : children) {
+        auto cardView = dynamic_cast<CardView*>(node);
+        if (cardView) _gameView->recycleCardView(cardView);
+        else node->removeFromParent();
+    }
+    _gameView->clearPlayFieldCards();
+
+    if (_isVirtualized) {
+        syncVisibleCards(true);
+        return;
+    }
 
     const auto& cards = _gameModel->getPlayFieldCards();
     for (auto cardModel : cards) {
-        auto cardView = CardView::createWithCardModel(cardModel);
-        if (!cardView) continue;
+        showCardView(cardModel);
+    }
+}
+
+void PlayFieldController::showCardView(CardModel* cardModel) {
+    auto cardView = _gameView->acquireCardView(cardModel);
+    if (!cardView) return;
+
+    cardView->setPosition(cardModel->getPosition());
+    cardView->setLocalZOrder(cardModel->getLocalZOrder());
+    cardView->flip(cardModel->isFaceUp());
+
+    _gameView->getPlayFieldLayer()->addChild(cardView);
+    bindCardView(cardView);
+}
+
+void PlayFieldController::syncVisibleCards(bool follow) {
+    CM_TRACE_SCOPE("PlayFieldController::syncVisibleCards");
+    if (!_gameView || !_gameModel) return;
+    auto layer = _gameView->getPlayFieldLayer();
+    if (!layer) return;
+
+    const auto& cards = _gameModel->getPlayFieldCards();
+    float bottomY = FLT_MAX;
+    float topY = -FLT_MAX;
+    for (auto card : cards) {
+        bottomY = std::min(bottomY, card->getPosition().y);
+        topY = std::max(topY, card->getPosition().y);
+    }
+    if (!cards.empty()) {
+        _gameView->setPlayFieldContentRange(bottomY, topY, follow);
+    }
 
-        cardView->setPosition(cardModel->getPosition());
-        cardView->setLocalZOrder(cardModel->getLocalZOrder());
-        cardView->flip(cardModel->isFaceUp());
+    // չΧͼڲŶСͼ
+    Rect viewport = _gameView->getPlayFieldViewport();
+    auto& children = layer->getChildren();
+    for (ssize_t i = children.size() - 1; i >= 0; i--) {
+        auto view = dynamic_cast<CardView*>(children.at(i));
+        if (!view || !view->getCardModel() || _gameView->getTweens().isAnimating(view)) continue;
 
-        if (cardModel->isFaceUp() && _cardClickHandler) {
-            cardView->setOnClickCallback(_cardClickHandler);
+        CardModel* card = view->getCardModel();
+        if (card->isInPlayField() && !viewport.containsPoint(card->getPosition())) {
+            _gameView->recycleCardView(view);
         }
+    }
 
-        playFieldLayer->addChild(cardView);
+    // ɼΧڵĿƶҪͼ ID ͼ tag
+    for (auto card : cards) {
+        if (!viewport.containsPoint(card->getPosition())) continue;
+        if (layer->getChildByTag(card->getId())) continue;
+        showCardView(card);
     }
 }
 
 void PlayFieldController::refreshViewStates() {
-    if (!_gameView) return;
+    CM_TRACE_SCOPE("PlayFieldController::refreshViewStates");
+    if (!_gameView || !_gameModel) return;
     auto layer = _gameView->getPlayFieldLayer();
     if (!layer) return;
 
@@ -72,18 +124,18 @@ void PlayFieldController::refreshViewStates() {
     for (auto node : children) {
         auto view = dynamic_cast<CardView*>(node);
         if (!view || !view->getCardModel()) continue;
+        // ڷƶѵĿ
+        if (!_gameModel->getPlayFieldCardById(view->getCardModel()->getId())) continue;
 
-        bool isFaceUp = view->getCardModel()->isFaceUp();
-        view->flip(isFaceUp);
-        if (isFaceUp && _cardClickHandler) {
-            view->setOnClickCallback(_cardClickHandler);
-        }
-        else {
-            view->setOnClickCallback(nullptr);
-        }
+        view->flip(view->getCardModel()->isFaceUp());
+        bindCardView(view);
     }
 }
 
+void PlayFieldController::bindCardView(CardView* view) {
+    if (view && _gameView) _gameView->registerPlayFieldCard(view);
+}
+
 void PlayFieldController::setGameModel(GameModel* gameModel) {
     if (_gameModel != gameModel) {
         CC_SAFE_RELEASE(_gameModel);
@@ -20,7 +20,8 @@
  * ʽ
  * -  GameModel ȡ
  * - ͨ GameView ͼ
- * - ͨص¼ίи GameController ҵ߼
+ * - ѿͼǼǵ GameView ĵ GameView ֱӷַ GameController
+ * - ޾ģʽֻΪɼΧڵĿƱͼΧͼյ GameView ͼ
  */
 class PlayFieldController : public cocos2d::Ref {
 public:
@@ -34,10 +35,24 @@ public:
 
     /**
      * @brief ȾϷп
-     * @details ͼ GameModel еĿ´ CardView
+     * @details ͼ GameModel еĿ· CardView
+     *          ⻯ʱֻΪɼΧڵĿƷͼ
      */
     void renderPlayField();
 
+    /**
+     * @brief ǷֻΪɼΧڵĿƱͼ޾ģʽ
+     */
+    void setVirtualized(bool virtualized) { _isVirtualized = virtualized; }
+
+    /**
+     * @brief ģͺͿɼΧͬϷͼ
+     * @param follow true ʱ GameView һ
+     * @details ΪɼΧͼĿƷͼչΧľֹͼ¹Χ
+     *          ϷȣϷй̶
+     */
+    void syncVisibleCards(bool follow);
+
     /**
      * @brief ˢпͼ״̬
      * @details  CardModel  faceUp ״̬ͼķ͵¼
@@ -45,11 +60,12 @@ public:
     void refreshViewStates();
 
     /**
-     * @brief ÿƵص
-     * @param handler ص GameController ṩ
+     * @brief ѿͼǼǵ GameView ĵ
+     * @param view λλõĿͼ
+     * @details ɵ״̬ȡͼǰ֮ķ GameView ģ¼ʱͬ
      */
-    void setCardClickHandler(const std::function<void(CardView*)>& handler);
-    
+    void bindCardView(CardView* view);
+
     /**
      * @brief ³е GameModel 
      * @param gameModel µϷģ
@@ -69,7 +85,13 @@ private:
      */
     bool init(GameModel* gameModel, GameView* gameView);
 
+    /**
+     * @brief ΪƷͼģ״̬ڷšǼ
+     * @param cardModel Ϸ
+     */
+    void showCardView(CardModel* cardModel);
+
     GameModel* _gameModel;                              ///< Ϸģ
     GameView* _gameView;                                ///< Ϸͼ
-    std::function<void(CardView*)> _cardClickHandler;   ///< Ƶص GameController ṩ
+    bool _isVirtualized;                                ///< ǷֻΪɼΧڵĿƱͼ
 };
\ No newline at end of file
@@ -0,0 +1,133 @@
+// --------------------------------------------------------
+// ļ: Classes/controllers/ReplayParityRunner.cpp
+// --------------------------------------------------------
+#include "ReplayParityRunner.h"
+#include "GameController.h"
+#include "services/GameSession.h"
+#include "utils/Logger.h"
+#include "utils/MonotonicArena.h"
+#include <random>
+
+USING_NS_CC;
+
+const int ReplayParityRunner::kUndoPercent;
+const int ReplayParityRunner::kRandomTapPercent;
+const unsigned ReplayParityRunner::kSeed;
+
+namespace {
+    //  GameModelGenerator һ£Ϸ ID Ϊ±꣬ ID Ϊ 1000 + CompiledLevel е±
+    const int kStockIdBase = 1000;
+
+    int toSessionIndex(const CardModel* card) {
+        if (!card) return -1;
+        return card->getId() >= kStockIdBase ? card->getId() - kStockIdBase : card->getId();
+    }
+
+    /**
+     * @brief ȶߵľ棬һʱһ
+     */
+    bool sameState(GameModel* model, const GameSession& session, const CompiledLevel& level, int step) {
+        int remaining = 0;
+        for (int i = 0; i < level.playfieldCount; i++) {
+            CardModel* card = model->getPlayFieldCardById(i);
+            if ((card != nullptr) != session.isInPlay(i)) {
+                CM_LOG_WARN(LC_PERF, "ReplayParity: step %d card %d in play: model %d, session %d",
+                            step, i, card != nullptr, session.isInPlay(i));
+                return false;
+            }
+            if (!card) continue;
+            remaining++;
+
+            // ϵδڵʱ泯
+            if (card->isFaceUp() == session.isBlocked(i)) {
+                CM_LOG_WARN(LC_PERF, "ReplayParity: step %d card %d face up: model %d, session blocked %d",
+                            step, i, card->isFaceUp(), session.isBlocked(i));
+                return false;
+            }
+        }
+        if (remaining != (int)model->getPlayFieldCards().size()) {
+            CM_LOG_WARN(LC_PERF, "ReplayParity: step %d model has %d play-field cards, %d with known IDs",
+                        step, (int)model->getPlayFieldCards().size(), remaining);
+            return false;
+        }
+
+        int modelTop = toSessionIndex(model->getTopStackCard());
+        int modelStock = model->getStockCount();
+        int sessionStock = level.stockCount - session.getDrawnCount();
+        if (modelTop != session.getTop() || modelStock != sessionStock) {
+            CM_LOG_WARN(LC_PERF, "ReplayParity: step %d top card %d / %d, stock %d / %d (model / session)",
+                        step, modelTop, session.getTop(), modelStock, sessionStock);
+            return false;
+        }
+
+        if (model->isGameOver() != session.isGameOver() || model->isGameWon() != session.isWon()) {
+            CM_LOG_WARN(LC_PERF, "ReplayParity: step %d game over %d / %d, won %d / %d (model / session)",
+                        step, model->isGameOver(), session.isGameOver(), model->isGameWon(), session.isWon());
+            return false;
+        }
+        return true;
+    }
+}
+
+bool ReplayParityRunner::run(GameController* controller, int steps) {
+    GameModel* model = controller ? controller->getGameModel() : nullptr;
+    if (!model || steps <= 0) return false;
+    if (controller->getLevelConfig().playfieldCards.empty()) {
+        CM_LOG_WARN(LC_PERF, "ReplayParity: endless mode has no level config to replay");
+        return false;
+    }
+
+    CompiledLevel level = CompiledLevel::compile(controller->getLevelConfig());
+    MonotonicArena arena;
+    GameSession session;
+    if (!session.start(&level, arena)) {
+        CM_LOG_WARN(LC_PERF, "ReplayParity: session could not start");
+        return false;
+    }
+
+    // ؿذԤСһһڴ飺ơڵбԤĳڵ㶼Ӧŵ
+    int mismatches = 0;
+    ModelArena* modelArena = model->getArena();
+    if (!modelArena || modelArena->getBlockCount() != 1) {
+        CM_LOG_WARN(LC_PERF, "ReplayParity: level load used %d arena block(s), expected 1",
+                    modelArena ? (int)modelArena->getBlockCount() : 0);
+        mismatches++;
+    }
+
+    std::mt19937 random(kSeed);
+    bool diverged = !sameState(model, session, level, 0);
+    int accepted = 0;
+    int rejected = 0;
+    int step = 0;
+
+    // һγֲߵľ治ٿɱȣֹͣ
+    for (; step < steps && !session.isGameOver() && !diverged; step++) {
+        int roll = (int)(random() % 100);
+        int move;
+        if (roll < kUndoPercent) {
+            move = SMC_UNDO;
+        }
+        else if (roll < kUndoPercent + kRandomTapPercent) {
+            move = (int)(random() % level.playfieldCount);
+        }
+        else {
+            int cardId = model->findPlayableCard();
+            move = cardId >= 0 ? cardId : SMC_DRAW;
+        }
+
+        if (move == SMC_UNDO) controller->onUndoClicked();
+        else if (move == SMC_DRAW) controller->onStockClicked();
+        else controller->onCardClicked(move);
+
+        if (session.apply(move)) accepted++;
+        else rejected++;
+
+        diverged = !sameState(model, session, level, step + 1);
+    }
+    if (diverged) mismatches++;
+
+    CM_LOG_INFO(LC_PERF, "ReplayParity: %d steps (%d accepted, %d rejected by GameSession), %s",
+                step, accepted, rejected, session.isGameOver() ? (session.isWon() ? "won" : "lost") : "unfinished");
+    CM_LOG_INFO(LC_PERF, "ReplayParity: %s", mismatches == 0 ? "PASS" : "FAIL");
+    return mismatches == 0;
+}
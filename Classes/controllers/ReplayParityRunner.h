@@ -0,0 +1,42 @@
+// --------------------------------------------------------
+// ļ: Classes/controllers/ReplayParityRunner.h
+// --------------------------------------------------------
+#ifndef __REPLAY_PARITY_RUNNER_H__
+#define __REPLAY_PARITY_RUNNER_H__
+
+class GameController;
+
+/**
+ * @class ReplayParityRunner
+ * @brief һԲԣͬһֱ GameModel  GameSession𲽱ȶԾ
+ *
+ * ְ
+ * - ̶ѡһƻơһϷƣΪǷ
+ * - ÿ֮˶Ϸʣ࿨ơڵ״̬ơʤ
+ * - ʼǰ˶Թؿֻһڴ飨ơڵбԤĳڵ㶼ԤΧڣ
+ *
+ * ʹó
+ * û CARDMATCH_REPLAY_PARITY=<> Ϸͨؿ
+ * GameController ֡вԲ˳뱨0 ͨ1 ʧܣ
+ *
+ * ԭ
+ * - ڼǿƼģʽÿڵ÷ǰ
+ * - GameModel һֻͨ GameController ĹӿҲͬһ·
+ *   GameSession һఴͬһݹؿñ룬 tools/validation_host طŷʽһ
+ */
+class ReplayParityRunner {
+public:
+    static const int kUndoPercent = 20;         ///< һĸʣ%
+    static const int kRandomTapPercent = 15;    ///< һϷƵĸʣ%
+    static const unsigned kSeed = 20261019;     ///< ӣͬһؿĽɸ
+
+    /**
+     * @brief в
+     * @param controller ѿʼϷĿͨؿ
+     * @param steps ִеĲԾֽʱǰֹͣ
+     * @return ÿһߵľ涼һ· true
+     */
+    static bool run(GameController* controller, int steps);
+};
+
+#endif // __REPLAY_PARITY_RUNNER_H__
@@ -1,14 +1,27 @@
 #include "StackController.h"
 #include "views/CardView.h"
+#include "utils/TraceProfiler.h"
 
 USING_NS_CC;
 
+const int StackController::kMaxFlights;
+
 StackController::StackController()
     : _gameModel(nullptr)
-    , _gameView(nullptr) {
+    , _gameView(nullptr)
+    , _listener(nullptr)
+    , _flightCount(0)
+    , _nextFlightId(0)
+    , _burstLevel(0)
+    , _isTurboMode(false) {
 }
 
 StackController::~StackController() {
+    for (int i = 0; i < _flightCount; i++) {
+        // ¼ָ򱾿ȡ
+        if (_gameView) _gameView->getTweens().cancel(_flights[i].view);
+        _flights[i].view->release();
+    }
     CC_SAFE_RELEASE(_gameModel);
     CC_SAFE_RELEASE(_gameView);
 }
@@ -35,8 +48,17 @@ bool StackController::init(GameModel* gameModel, GameView* gameView) {
 }
 
 void StackController::updateStackView() {
+    CM_TRACE_SCOPE("StackController::updateStackView");
     if (!_gameView || !_gameModel) return;
-    _gameView->updateStackView(_gameModel->getTopStackCard());
+    StackCardFace cards[GameView::kStackFanSize];
+    int count = 0;
+    for (CardModel* card = _gameModel->getStackCard(0); card && count < GameView::kStackFanSize;
+         card = _gameModel->getStackCard(count)) {
+        cards[count].suit = card->getSuit();
+        cards[count].face = card->getFace();
+        count++;
+    }
+    _gameView->updateStackView(cards, count);
 }
 
 void StackController::updateStockView() {
@@ -44,20 +66,10 @@ void StackController::updateStockView() {
     _gameView->updateStockView(_gameModel->getStockCount());
 }
 
-void StackController::drawCardFromStock(const std::function<void(CardModel*)>& onComplete) {
-    if (!_gameModel || _gameModel->getStockCount() <= 0) {
-        if (onComplete) onComplete(nullptr);
-        return;
-    }
+void StackController::playStockDraw(const MoveRecord& record) {
+    if (!record.isValid() || !_gameView) return;
 
-    CardModel* drawnCard = _gameModel->drawStockCard();
-    if (!drawnCard) {
-        if (onComplete) onComplete(nullptr);
-        return;
-    }
-    drawnCard->setFaceUp(true);
-
-    auto cardView = CardView::createWithCardModel(drawnCard);
+    auto cardView = _gameView->acquireCardView(record.card);
     Vec2 startPos = _gameView->getPlayFieldLayer()->convertToNodeSpace(_gameView->getStockPosition());
     Vec2 endPos = _gameView->getPlayFieldLayer()->convertToNodeSpace(_gameView->getStackPosition());
 
@@ -65,101 +77,122 @@ void StackController::drawCardFromStock(const std::function<void(CardModel*)>& o
     cardView->flip(true);
     _gameView->getPlayFieldLayer()->addChild(cardView, 2000);
 
-    auto move = MoveTo::create(0.4f, endPos);
-    auto callback = CallFunc::create([this, drawnCard, cardView, onComplete]() {
-        this->_gameModel->setTopStackCard(drawnCard);
-        this->updateStackView();
-        this->updateStockView();
-        cardView->removeFromParent();
-        
-        if (onComplete) onComplete(drawnCard);
-        drawnCard->release();
-    });
-    
-    cardView->runAction(Sequence::create(move, callback, nullptr));
+    runFlight(cardView, endPos, 0.4f, true, FK_TO_STACK);
 }
 
-void StackController::moveCardToStack(CardModel* card, const Vec2& fromPos, 
-                                      const std::function<void()>& onComplete) {
-    if (!card || !_gameView) {
-        if (onComplete) onComplete();
-        return;
-    }
+void StackController::playMoveToStack(const MoveRecord& record) {
+    CardView* cardView = (record.isValid() && _gameView) ? findPlayFieldCardView(record.card) : nullptr;
+    if (!cardView) return;
 
-    card->retain();
+    // ʱڲŲƥ䶶ȸλԭλ
+    _gameView->getTweens().cancel(cardView);
+    cardView->setPosition(record.cardPosition);
+    cardView->setLocalZOrder(2000);
+    _gameView->unregisterPlayFieldCard(record.card->getId());
+    Vec2 targetPos = _gameView->getPlayFieldLayer()->convertToNodeSpace(_gameView->getStackPosition());
 
-    auto playFieldLayer = _gameView->getPlayFieldLayer();
-    if (!playFieldLayer) {
-        card->release();
-        if (onComplete) onComplete();
-        return;
-    }
+    runFlight(cardView, targetPos, 0.4f, true, FK_TO_STACK);
+}
+
+void StackController::playUndo(const MoveRecord& record) {
+    if (!record.isValid() || !_gameView) return;
+
+    // ƺͱ¼ˢ£ӱ¸ǵĿ濨Ʒɻͬʱ
+    if (record.type == MT_STOCK_TO_STACK) return;
+
+    auto cardView = _gameView->acquireCardView(record.card);
+    Vec2 startPos = _gameView->getPlayFieldLayer()->convertToNodeSpace(_gameView->getStackPosition());
+    cardView->setPosition(startPos);
+    cardView->setLocalZOrder(2000);
+    cardView->flip(true);
+    _gameView->getPlayFieldLayer()->addChild(cardView);
+
+    runFlight(cardView, record.cardPosition, 0.3f, false, FK_UNDO);
+}
+
+CardView* StackController::findPlayFieldCardView(CardModel* card) {
+    auto playFieldLayer = _gameView ? _gameView->getPlayFieldLayer() : nullptr;
+    if (!playFieldLayer) return nullptr;
 
-    CardView* cardView = nullptr;
     for (auto node : playFieldLayer->getChildren()) {
         auto view = dynamic_cast<CardView*>(node);
-        if (view && view->getCardModel() == card) {
-            cardView = view;
-            break;
-        }
+        if (view && view->getCardModel() == card) return view;
     }
+    return nullptr;
+}
 
-    if (!cardView) {
-        card->release();
-        if (onComplete) onComplete();
+void StackController::runFlight(CardView* view, const Vec2& target, float duration, bool holdsPresentation,
+                                FlightKind kind) {
+    // ģʽм¼ֱ䵽յ㣬ͬ
+    if (_isTurboMode || _flightCount == kMaxFlights) {
+        _gameView->getTweens().cancel(view);
+        view->setPosition(target);
+        landFlight(kind, view);
         return;
     }
 
-    cardView->setLocalZOrder(2000);
-    Vec2 targetPos = playFieldLayer->convertToNodeSpace(_gameView->getStackPosition());
-
-    auto move = MoveTo::create(0.4f, targetPos);
-    auto callback = CallFuncN::create([this, card, onComplete](Node* sender) {
-        CardView* viewToRemove = dynamic_cast<CardView*>(sender);
-        
-        this->_gameModel->removePlayFieldCard(card);
-        this->_gameModel->setTopStackCard(card);
-        this->updateStackView();
-        
-        if (viewToRemove) viewToRemove->removeFromParent();
-        
-        if (onComplete) onComplete();
-        card->release();
-    });
-    
-    cardView->runAction(Sequence::create(move, callback, nullptr));
+    PendingFlight& flight = _flights[_flightCount++];
+    flight.id = _nextFlightId++;
+    flight.kind = kind;
+    flight.view = view;
+    flight.target = target;
+    flight.holdsPresentation = holdsPresentation;
+    view->retain();
+    if (holdsPresentation) _gameView->beginPresentationHold();
+
+    // ٲʱ̶ͼ׷ģ
+    float speedUp = 1.0f + (float)std::min(_burstLevel, 3);
+    TweenManager& tweens = _gameView->getTweens();
+    int tweenId = tweens.moveTo(view, target, duration / speedUp);
+    if (tweenId < 0) {
+        // յ㣬Ȼ
+        completeFlight(flight.id);
+        return;
+    }
+    tweens.setCompletion(tweenId, this, flight.id);
 }
 
-void StackController::undoDrawCard(CardModel* card) {
-    if (!card || !_gameModel) return;
-    
-    _gameModel->returnToStock(card);
-    updateStockView();
+void StackController::onTweenFinished(int userData) {
+    _burstLevel = 0;
+    completeFlight(userData);
 }
 
-void StackController::undoMoveToStack(CardModel* card, const Vec2& originalPos, 
-                                      const std::function<void()>& onComplete) {
-    if (!card || !_gameView) {
-        if (onComplete) onComplete();
+void StackController::completeFlight(int flightId) {
+    for (int i = 0; i < _flightCount; i++) {
+        if (_flights[i].id != flightId) continue;
+
+        // ƳбٴпµĶ
+        PendingFlight flight = _flights[i];
+        for (int j = i + 1; j < _flightCount; j++) _flights[j - 1] = _flights[j];
+        _flightCount--;
+
+        if (flight.holdsPresentation) _gameView->endPresentationHold();
+        landFlight(flight.kind, flight.view);
+        flight.view->release();
         return;
     }
+}
 
-    _gameModel->addPlayFieldCard(card);
-
-    auto cardView = CardView::createWithCardModel(card);
-    Vec2 startPos = _gameView->getPlayFieldLayer()->convertToNodeSpace(_gameView->getStackPosition());
-    cardView->setPosition(startPos);
-    cardView->setLocalZOrder(2000);
-    cardView->flip(true);
-    _gameView->getPlayFieldLayer()->addChild(cardView);
+void StackController::landFlight(FlightKind kind, CardView* view) {
+    switch (kind) {
+    case FK_TO_STACK:
+        _gameView->recycleCardView(view);
+        break;
+    case FK_UNDO:
+        view->setLocalZOrder(view->getCardModel()->getLocalZOrder());
+        if (_listener) _listener->onUndoFlightLanded(view);
+        break;
+    }
+}
 
-    auto move = MoveTo::create(0.3f, originalPos);
-    auto callback = CallFunc::create([this, cardView, card, onComplete]() {
-        cardView->setLocalZOrder(card->getLocalZOrder());
-        
-        if (onComplete) onComplete();
-    });
-    cardView->runAction(Sequence::create(move, callback, nullptr));
+void StackController::finishPendingMoves() {
+    while (_flightCount > 0) {
+        const PendingFlight& flight = _flights[0];
+        _gameView->getTweens().cancel(flight.view);
+        flight.view->setPosition(flight.target);
+        completeFlight(flight.id);
+        _burstLevel++;
+    }
 }
 
 void StackController::setGameModel(GameModel* gameModel) {
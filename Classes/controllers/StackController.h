@@ -4,6 +4,22 @@
 #include "models/GameModel.h"
 #include "views/GameView.h"
 #include "models/CardModel.h"
+#include "views/CardView.h"
+
+/**
+ * @class StackControllerListener
+ * @brief Ʒн¼Ľշ
+ */
+class StackControllerListener {
+public:
+    virtual ~StackControllerListener() {}
+
+    /**
+     * @brief ɻϷĿ䵽ԭλ
+     * @param cardView ͼ½ѼϷ㣩
+     */
+    virtual void onUndoFlightLanded(CardView* cardView) = 0;
+};
 
 /**
  * @class StackController
@@ -20,10 +36,14 @@
  * 
  * ԭ
  * - װƶصĶ߼
- * - ͨص֪ͨ GameController 
+ * - ͨ StackControllerListener ֪ͨ GameController Ŀ
  * - ֱӴҵ߼ֻͼͶ
+ * - ֻȡ GameModel ύ󷵻ص MoveRecord޸ģ
+ * - ƺͱʾ GameView ģ¼ɣֻж
+ * - ж GameView  TweenManager ţΪ TweenListener յ¼
+ *   Ĵͷɣм¼ڶУƺͳڴ
  */
-class StackController : public cocos2d::Ref {
+class StackController : public cocos2d::Ref, public TweenListener {
 public:
     /**
      * @brief ʵ
@@ -46,38 +66,37 @@ public:
     void updateStockView();
 
     /**
-     * @brief ӱƶѳȡһ
-     * @param onComplete ɻصΪȡĿƣʧʱΪ nullptr
-     * @details ִдӱƶѵƶѵƶɺ GameModel
+     * @brief ÷н¼Ľշ
+     * @param listener շУnullptr ʾ֪ͨ
+     */
+    void setListener(StackControllerListener* listener) { _listener = listener; }
+
+    /**
+     * @brief ŴӱƶѳƵĶ
+     * @param record GameModel::applyStockDraw صı¼
+     * @details ģڵǰύڼбƶʾɵƣº¼ˢ
      */
-    void drawCardFromStock(const std::function<void(CardModel*)>& onComplete);
+    void playStockDraw(const MoveRecord& record);
 
     /**
-     * @brief ϷĿƶƶ
-     * @param card ҪƶĿģ
-     * @param fromPos ʼλã꣩
-     * @param onComplete ɻص
-     * @details ִƶɺϷƳƲ³ƶ
+     * @brief ϷƷƶѵĶ
+     * @param record GameModel::applyPlayFieldMove صı¼
      */
-    void moveCardToStack(CardModel* card, const cocos2d::Vec2& fromPos, 
-                         const std::function<void()>& onComplete);
+    void playMoveToStack(const MoveRecord& record);
 
     /**
-     * @brief ӱƶѳƲ
-     * @param card ҪŻصĿ
-     * @details ƷŻرƶѣִж
+     * @brief ų
+     * @param record GameModel::undoMove ص¼
+     * @details ƲŶʱƴӳƶѷɻԭλãº֪ͨ StackControllerListener
      */
-    void undoDrawCard(CardModel* card);
+    void playUndo(const MoveRecord& record);
 
     /**
-     * @brief ϷƲ
-     * @param card ҪָĿ
-     * @param originalPos ԭʼλãϷ꣩
-     * @param onComplete ɻص
-     * @details ִдӳƶѷɻϷĶ
+     * @brief üģʽ
+     * @param enabled true ʱж˲ɣصִͬУڲԣ
      */
-    void undoMoveToStack(CardModel* card, const cocos2d::Vec2& originalPos, 
-                         const std::function<void()>& onComplete);
+    void setTurboMode(bool enabled) { _isTurboMode = enabled; }
+    bool isTurboMode() const { return _isTurboMode; }
 
     /**
      * @brief ³е GameModel 
@@ -86,7 +105,49 @@ public:
      */
     void setGameModel(GameModel* gameModel);
 
+    /**
+     * @brief ǷδɵĿƷж
+     * @return δɶ true
+     */
+    bool hasPendingMoves() const { return _flightCount > 0; }
+
+    /**
+     * @brief зж
+     * @details ֱյ㲢ִɻصʹͼ׷ģͣ
+     *          ʱ GameController ãԶ
+     */
+    void finishPendingMoves();
+
+    /**
+     * @brief в䵽յ㣨TweenListener
+     * @param userData 
+     */
+    void onTweenFinished(int userData) override;
+
 private:
+    static const int kMaxFlights = 8;   ///< ͬʱеķޣÿִǰһηУ
+
+    /**
+     * @enum FlightKind
+     * @brief ͣյĴ
+     */
+    enum FlightKind {
+        FK_TO_STACK,     ///< ƶѣºͼ
+        FK_UNDO          ///< ɻϷºָ㼶֪ͨշ
+    };
+
+    /**
+     * @struct PendingFlight
+     * @brief һνеĿƷж
+     */
+    struct PendingFlight {
+        int id;                              ///< 
+        FlightKind kind;                     ///< 
+        CardView* view;                      ///< еĿͼ retain
+        cocos2d::Vec2 target;                ///< յλ
+        bool holdsPresentation;              ///< Ƿ GameView ı
+    };
+
     StackController();
     ~StackController();
 
@@ -98,6 +159,42 @@ private:
      */
     bool init(GameModel* gameModel, GameView* gameView);
 
-    GameModel* _gameModel;  ///< Ϸģ
-    GameView* _gameView;    ///< Ϸͼ
+    /**
+     * @brief һοƷж
+     * @param view ҪƶĿͼ
+     * @param target յλãϷ꣩
+     * @param duration ٶµĶʱ
+     * @param holdsPresentation ڼǷͣ GameView ģ¼
+     * @param kind 
+     * @details ģʽм¼ʱֱ䵽յ
+     */
+    void runFlight(CardView* view, const cocos2d::Vec2& target, float duration, bool holdsPresentation,
+                   FlightKind kind);
+
+    /**
+     * @brief ָжȻ򱻿ʱã
+     * @param flightId 
+     */
+    void completeFlight(int flightId);
+
+    /**
+     * @brief 䵽յ󰴷ʹ
+     */
+    void landFlight(FlightKind kind, CardView* view);
+
+    /**
+     * @brief ϷпƶӦͼ
+     * @param card ģ
+     * @return ͼڷ nullptr
+     */
+    CardView* findPlayFieldCardView(CardModel* card);
+
+    GameModel* _gameModel;                       ///< Ϸģ
+    GameView* _gameView;                         ///< Ϸͼ
+    StackControllerListener* _listener;          ///< н¼Ľշ
+    PendingFlight _flights[kMaxFlights];         ///< еķжʼ˳У
+    int _flightCount;                            ///< еķ
+    int _nextFlightId;                           ///< һ
+    int _burstLevel;                             ///< Ĵ̺
+    bool _isTurboMode;                           ///< ģʽ˲
 };
\ No newline at end of file
@@ -0,0 +1,132 @@
+// Classes/managers/AssetPreloader.cpp
+#include "AssetPreloader.h"
+#include "managers/TextureResidency.h"
+#include "utils/Logger.h"
+#include "json/document.h"
+#include <algorithm>
+
+USING_NS_CC;
+
+AssetPreloader::AssetPreloader()
+    : _nextIndex(0)
+    , _doneCount(0)
+    , _failedCount(0)
+    , _finished(false)
+    , _startTime(0.0)
+    , _elapsedMs(0.0f) {
+}
+
+AssetPreloader::~AssetPreloader() {
+    // ǰʱù߳첻Ͷݵ̵߳Ļصɵ÷֤
+    _nextIndex = (int)_paths.size();
+    joinWorkers();
+}
+
+std::vector<std::string> AssetPreloader::loadManifest(const std::string& path) {
+    std::vector<std::string> paths;
+
+    std::string content = FileUtils::getInstance()->getStringFromFile(path);
+    if (content.empty()) {
+        CM_LOG_WARN(LC_ASSET, "Preload manifest not found: %s", path.c_str());
+        return paths;
+    }
+
+    rapidjson::Document doc;
+    doc.Parse(content.c_str());
+    if (doc.HasParseError() || !doc.HasMember("Textures") || !doc["Textures"].IsArray()) {
+        CM_LOG_WARN(LC_ASSET, "Invalid preload manifest: %s", path.c_str());
+        return paths;
+    }
+
+    const rapidjson::Value& textures = doc["Textures"];
+    for (rapidjson::SizeType i = 0; i < textures.Size(); i++) {
+        if (textures[i].IsString()) {
+            paths.push_back(textures[i].GetString());
+        }
+    }
+    return paths;
+}
+
+void AssetPreloader::start(const std::vector<std::string>& paths, const ProgressCallback& onProgress,
+                           const CompleteCallback& onComplete) {
+    _paths = paths;
+    _onProgress = onProgress;
+    _onComplete = onComplete;
+    _doneCount = 0;
+    _failedCount = 0;
+    _finished = false;
+    _startTime = utils::gettime();
+
+    // ·߳̽FileUtils ·治̰߳ȫ
+    auto fileUtils = FileUtils::getInstance();
+    _fullPaths.clear();
+    for (const auto& path : _paths) {
+        _fullPaths.push_back(fileUtils->fullPathForFilename(path));
+    }
+
+    if (_paths.empty()) {
+        _finished = true;
+        if (_onComplete) _onComplete();
+        return;
+    }
+
+    int hardwareThreads = (int)std::thread::hardware_concurrency();
+    int workerCount = std::max(1, std::min(std::min(hardwareThreads - 1, kMaxWorkers), (int)_paths.size()));
+    _nextIndex = 0;
+    for (int i = 0; i < workerCount; i++) {
+        _workers.push_back(std::thread(&AssetPreloader::workerLoop, this));
+    }
+    CM_LOG_INFO(LC_ASSET, "Preloading %d textures on %d threads", (int)_paths.size(), workerCount);
+}
+
+void AssetPreloader::workerLoop() {
+    auto scheduler = Director::getInstance()->getScheduler();
+    int total = (int)_fullPaths.size();
+
+    for (;;) {
+        int index = _nextIndex++;
+        if (index >= total) break;
+
+        Image* image = nullptr;
+        if (!_fullPaths[index].empty()) {
+            image = new (std::nothrow) Image();
+            if (image && !image->initWithImageFile(_fullPaths[index])) {
+                image->release();
+                image = nullptr;
+            }
+        }
+        scheduler->performFunctionInCocosThread([this, index, image]() {
+            this->onImageDecoded(index, image);
+        });
+    }
+}
+
+void AssetPreloader::onImageDecoded(int index, Image* image) {
+    if (image) {
+        TextureResidency::getInstance()->acquireDecoded(_paths[index], _fullPaths[index], image);
+        image->release();
+    }
+    else {
+        CM_LOG_WARN(LC_ASSET, "Preload failed: %s", _paths[index].c_str());
+        _failedCount++;
+    }
+
+    _doneCount++;
+    int total = (int)_paths.size();
+    if (_onProgress) _onProgress(_doneCount, total);
+    if (_doneCount < total) return;
+
+    // һѻص̶̣߳߳񣬵ȴ˳
+    joinWorkers();
+    _finished = true;
+    _elapsedMs = (float)((utils::gettime() - _startTime) * 1000.0);
+    CM_LOG_INFO(LC_ASSET, "Preloaded %d textures in %.0f ms (%d failed)", total - _failedCount, _elapsedMs, _failedCount);
+    if (_onComplete) _onComplete();
+}
+
+void AssetPreloader::joinWorkers() {
+    for (auto& worker : _workers) {
+        if (worker.joinable()) worker.join();
+    }
+    _workers.clear();
+}
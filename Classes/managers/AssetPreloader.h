@@ -0,0 +1,97 @@
+// Classes/managers/AssetPreloader.h
+#ifndef __ASSET_PRELOADER_H__
+#define __ASSET_PRELOADER_H__
+
+#include "cocos2d.h"
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @class AssetPreloader
+ * @brief ʱнԤ
+ *
+ * ְ
+ * - ȡԤ嵥Resources/preload.jsonгƵɫͱͼ
+ * - ڶ߳ϲнͼƬ߳ϴΪǼǵ TextureResidency
+ * - ÿһűһνȣȫɺصʱ
+ *
+ * ʹó
+ * GameController::startGame Ԥزʾ LoadingViewԤɺٴ GameView Ⱦؿ
+ * ֡ Sprite ֱ TextureCache߳Ͻ PNG/JPEG
+ *
+ * ԭ
+ * - ֻ߳ļȡͽ루cocos2d::Imageϴ͵Ǽͨ
+ *   Scheduler::performFunctionInCocosThread ص߳
+ * - ʹ TextureCache::addImageAsyncֻһ̣߳ͼƬֻܴн
+ * - ʧܵͼƬֻ֮״ʹʱԭȵķʽͬ
+ */
+class AssetPreloader {
+public:
+    typedef std::function<void(int done, int total)> ProgressCallback;
+    typedef std::function<void()> CompleteCallback;
+
+    static const int kMaxWorkers = 4;   ///< ߳
+
+    AssetPreloader();
+    ~AssetPreloader();
+
+    /**
+     * @brief ȡԤ嵥
+     * @param path 嵥ļ·
+     * @return ͼƬ·бļȱʧʽʱΪ
+     */
+    static std::vector<std::string> loadManifest(const std::string& path);
+
+    /**
+     * @brief ʼԤ
+     * @param paths ͼƬ·
+     * @param onProgress ÿһŵһΣ̣߳
+     * @param onComplete ȫɺһΣ̣߳бΪʱڱεֱӻص
+     */
+    void start(const std::vector<std::string>& paths, const ProgressCallback& onProgress,
+               const CompleteCallback& onComplete);
+
+    bool isFinished() const { return _finished; }
+
+    /**
+     * @brief ӿʼȫɵĺʱ룩
+     */
+    float getElapsedMs() const { return _elapsedMs; }
+
+    int getFailedCount() const { return _failedCount; }
+
+private:
+    /**
+     * @brief ̣߳ȡһͼƬ
+     */
+    void workerLoop();
+
+    /**
+     * @brief ̣߳ϴһŽõͼƬ
+     * @param index ͼƬ嵥е±
+     * @param image ʧΪ nullptr
+     */
+    void onImageDecoded(int index, cocos2d::Image* image);
+
+    /**
+     * @brief ȴй߳˳
+     */
+    void joinWorkers();
+
+    std::vector<std::string> _paths;       ///< 嵥е·TextureResidency ĵǼǼ
+    std::vector<std::string> _fullPaths;   ///< ·ֻ߳
+    std::vector<std::thread> _workers;     ///< ߳
+    std::atomic<int> _nextIndex;           ///< һŴ±
+    int _doneCount;                        ///< ϴʧܣ
+    int _failedCount;                      ///< ʧܵ
+    bool _finished;                        ///< Ƿȫ
+    double _startTime;                     ///< ʼʱ䣨룩
+    float _elapsedMs;                      ///< ܺʱ룩
+    ProgressCallback _onProgress;
+    CompleteCallback _onComplete;
+};
+
+#endif
@@ -0,0 +1,89 @@
+// Classes/managers/FrameRateGovernor.cpp
+#include "FrameRateGovernor.h"
+#include "cocos2d.h"
+#include "utils/Logger.h"
+#include <ctime>
+
+USING_NS_CC;
+
+const float FrameRateGovernor::kIdleInterval = 1.0f / 4.0f;
+const float FrameRateGovernor::kIdleDelay = 0.5f;
+const float FrameRateGovernor::kStatsWindow = 60.0f;
+
+namespace {
+    void resetStats(RenderStats& stats) {
+        stats.seconds = 0.0f;
+        stats.frames = 0;
+        stats.idleFrames = 0;
+        stats.idleSeconds = 0.0f;
+        stats.cpuMs = 0.0f;
+    }
+}
+
+FrameRateGovernor::FrameRateGovernor()
+    : _enabled(false)
+    , _isIdle(false)
+    , _activeInterval(1.0f / 60.0f)
+    , _quietTime(0.0f)
+    , _windowStartClock((long)std::clock()) {
+    resetStats(_window);
+    resetStats(_lastStats);
+}
+
+void FrameRateGovernor::setEnabled(bool enabled) {
+    if (enabled == _enabled) return;
+
+    if (enabled) {
+        _activeInterval = Director::getInstance()->getAnimationInterval();
+    }
+    else {
+        setIdle(false);
+    }
+    _enabled = enabled;
+    _quietTime = 0.0f;
+}
+
+void FrameRateGovernor::wake() {
+    _quietTime = 0.0f;
+    setIdle(false);
+}
+
+void FrameRateGovernor::update(float dt, bool busy) {
+    sample(dt);
+    if (!_enabled) return;
+
+    if (busy) {
+        wake();
+        return;
+    }
+
+    _quietTime += dt;
+    if (!_isIdle && _quietTime >= kIdleDelay) {
+        setIdle(true);
+    }
+}
+
+void FrameRateGovernor::setIdle(bool idle) {
+    if (idle == _isIdle) return;
+    _isIdle = idle;
+    Director::getInstance()->setAnimationInterval(idle ? kIdleInterval : _activeInterval);
+}
+
+void FrameRateGovernor::sample(float dt) {
+    _window.seconds += dt;
+    _window.frames++;
+    if (_isIdle) {
+        _window.idleFrames++;
+        _window.idleSeconds += dt;
+    }
+    if (_window.seconds < kStatsWindow) return;
+
+    long now = (long)std::clock();
+    _window.cpuMs = (float)(now - _windowStartClock) * 1000.0f / CLOCKS_PER_SEC;
+    _lastStats = _window;
+    CM_LOG_INFO(LC_PERF, "Render stats: %d frames in %.0fs (%d idle frames, %.0fs idle), cpu %.0f ms",
+          _lastStats.frames, _lastStats.seconds, _lastStats.idleFrames, _lastStats.idleSeconds, _lastStats.cpuMs);
+
+    resetStats(_window);
+    _windowStartClock = now;
+}
@@ -0,0 +1,91 @@
+// Classes/managers/FrameRateGovernor.h
+#ifndef __FRAME_RATE_GOVERNOR_H__
+#define __FRAME_RATE_GOVERNOR_H__
+
+/**
+ * @struct RenderStats
+ * @brief һͳƴڵȾ
+ */
+struct RenderStats {
+    float seconds;       ///< ʱ룩
+    int frames;          ///< Ⱦ֡
+    int idleFrames;      ///< Կ֡Ⱦ֡
+    float idleSeconds;   ///< ڿ֡ʵʱ룩
+    float cpuMs;         ///< ĵ CPU ʱ䣨룬̣߳
+};
+
+/**
+ * @class FrameRateGovernor
+ * @brief Ⱦ֡ʵ
+ *
+ * ְ
+ * - 澲ֹһʱ Director ֵ֡д򶯻ʱָȫ
+ * - ͳȾ֡ʱ CPU ʱ䣬ģʽĽʡ
+ *
+ * ʹó
+ *  GameView УGameView ÿ֡ܲ䡢Actionʹ״̬ update
+ * ʼʱ wake
+ *
+ * ԭ
+ * - ֻģʽлʱ Director::setAnimationIntervalл Director һ֡ dt Ϊ 0֡
+ * - ֹжӳ kIdleDelay 룬֮֡䲻л
+ */
+class FrameRateGovernor {
+public:
+    static const float kIdleInterval;   ///< ʱ֡룩
+    static const float kIdleDelay;      ///< 澲ֹú֡ʣ룩
+    static const float kStatsWindow;    ///< ͳƴʱ룩
+
+    FrameRateGovernor();
+
+    /**
+     * @brief ûرհȾ
+     * @details ʱ¼ Director ǰ֡Ϊȫ֡رʱָȫ
+     */
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return _enabled; }
+
+    /**
+     * @brief µⲿָȫ
+     */
+    void wake();
+
+    /**
+     * @brief ÿ֡һ
+     * @param dt ֡
+     * @param busy ֡ǷжеĴ
+     */
+    void update(float dt, bool busy);
+
+    /**
+     * @brief ǰǷڿ֡
+     */
+    bool isIdle() const { return _isIdle; }
+
+    /**
+     * @brief һͳƴڵ
+     */
+    const RenderStats& getLastStats() const { return _lastStats; }
+
+private:
+    /**
+     * @brief лȫ/֡
+     */
+    void setIdle(bool idle);
+
+    /**
+     * @brief ۼƱ֡ͳݣڽʱ־
+     */
+    void sample(float dt);
+
+    bool _enabled;                ///< ǷðȾ
+    bool _isIdle;                 ///< Ƿڿ֡
+    float _activeInterval;        ///< ȫ֡룩
+    float _quietTime;             ///< ֹʱ룩
+
+    RenderStats _window;          ///< ǰͳƴ
+    RenderStats _lastStats;       ///< һͳƴ
+    long _windowStartClock;       ///< ڿʼʱ std::clock()
+};
+
+#endif
@@ -0,0 +1,35 @@
+// Classes/managers/GameEventBus.cpp
+#include "GameEventBus.h"
+
+GameEventBus::GameEventBus()
+    : _head(0)
+    , _tail(0)
+    , _dropped(0) {
+}
+
+bool GameEventBus::publish(const GameEvent& event) {
+    uint32_t head = _head.load(std::memory_order_relaxed);
+    uint32_t tail = _tail.load(std::memory_order_acquire);
+    if (head - tail >= kCapacity) {
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    _events[head & (kCapacity - 1)] = event;
+    _head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+bool GameEventBus::poll(GameEvent& outEvent) {
+    uint32_t tail = _tail.load(std::memory_order_relaxed);
+    uint32_t head = _head.load(std::memory_order_acquire);
+    if (tail == head) return false;
+
+    outEvent = _events[tail & (kCapacity - 1)];
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+void GameEventBus::clear() {
+    _tail.store(_head.load(std::memory_order_acquire), std::memory_order_release);
+}
@@ -0,0 +1,92 @@
+// Classes/managers/GameEventBus.h
+#ifndef __GAME_EVENT_BUS_H__
+#define __GAME_EVENT_BUS_H__
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @enum GameEventType
+ * @brief ģͷͼ¼
+ */
+enum GameEventType {
+    GET_CARD_REMOVED,         ///< 뿪Ϸ
+    GET_CARD_REVEALED,        ///< ϷƷ
+    GET_CARD_COVERED,         ///< ϷƷر
+    GET_TOP_CHANGED,          ///< Ʊ仯cardId Ϊ -1 ʾƶΪգ·ʾ
+    GET_STOCK_COUNT_CHANGED,  ///< 仯value Ϊʣ
+    GET_GAME_OVER,            ///< Ϸvalue Ϊ 1 ʾʤ
+    GET_CARD_ADDED            ///< Ϸ¿ƣ޾ģʽƣ
+};
+
+/**
+ * @struct GameEvent
+ * @brief һģ¼
+ *
+ * ֵֶֻΣЯ Ref ָ룬ķҪģͼʾ
+ */
+struct GameEvent {
+    static const int kMaxBeneathCards = 2;  ///< GET_TOP_CHANGED ĵ·
+
+    GameEventType type;  ///< ¼
+    int cardId;          ///< ؿ ID޹ʱΪ -1
+    int suit;            ///< ɫ GET_TOP_CHANGED Ч
+    int face;            ///<  GET_TOP_CHANGED Ч
+    int value;           ///< ֵ GameEventTypeGET_TOP_CHANGED ʱΪ·
+    int beneathSuit[kMaxBeneathCards];  ///< ·ƵĻɫ[0] ƣ GET_TOP_CHANGED Ч
+    int beneathFace[kMaxBeneathCards];  ///< ·Ƶĵ
+};
+
+/**
+ * @class GameEventBus
+ * @brief ģ͵ͼ¼
+ *
+ * ְ
+ * -  GameModel ¼ֱͼһ֡ͳһ
+ * - ͬһ֡ڵͼ޸ĺϲһα
+ *
+ * ʹó
+ * Ϊ GameController ĳԱGameModel ͨ publish д룬
+ * GameView ÿ֡ update е poll ȡַ
+ *
+ * ԭ
+ * -  / ߻ζУдڴ棬
+ *   ģͿԷŵģ߳
+ * - ʱ¼
+ * - ֻ𴫵ݣҵ߼
+ */
+class GameEventBus {
+public:
+    static const uint32_t kCapacity = 256;  ///< ζ 2 ݣ
+
+    GameEventBus();
+
+    /**
+     * @brief һ¼ߵã
+     * @param event ¼
+     * @return  false
+     */
+    bool publish(const GameEvent& event);
+
+    /**
+     * @brief ȡһ¼ߵã
+     * @param outEvent 洢ȡ¼
+     * @return Ϊշ false
+     */
+    bool poll(GameEvent& outEvent);
+
+    /**
+     * @brief δ¼ߵã
+     */
+    void clear();
+
+    uint64_t getDroppedCount() const { return _dropped.load(std::memory_order_relaxed); }
+
+private:
+    GameEvent _events[kCapacity];
+    std::atomic<uint32_t> _head;      ///< дָ룬޸
+    std::atomic<uint32_t> _tail;      ///< ָ룬޸
+    std::atomic<uint64_t> _dropped;   ///< ¼
+};
+
+#endif
\ No newline at end of file
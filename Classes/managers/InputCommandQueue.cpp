@@ -0,0 +1,29 @@
+// Classes/managers/InputCommandQueue.cpp
+#include "InputCommandQueue.h"
+
+InputCommandQueue::InputCommandQueue()
+    : _head(0)
+    , _count(0) {
+}
+
+bool InputCommandQueue::push(const InputCommand& command) {
+    if (_count >= kCapacity) return false;
+
+    _commands[(_head + _count) % kCapacity] = command;
+    _count++;
+    return true;
+}
+
+bool InputCommandQueue::pop(InputCommand& outCommand) {
+    if (_count == 0) return false;
+
+    outCommand = _commands[_head];
+    _head = (_head + 1) % kCapacity;
+    _count--;
+    return true;
+}
+
+void InputCommandQueue::clear() {
+    _head = 0;
+    _count = 0;
+}
@@ -0,0 +1,76 @@
+// Classes/managers/InputCommandQueue.h
+#ifndef __INPUT_COMMAND_QUEUE_H__
+#define __INPUT_COMMAND_QUEUE_H__
+
+/**
+ * @enum InputCommandType
+ * @brief 
+ */
+enum InputCommandType {
+    ICT_CARD_TAP,    ///< Ϸ
+    ICT_STOCK_TAP,   ///< ƶ
+    ICT_UNDO,        ///< ť
+    ICT_HISTORY_JUMP ///< תʷеĳ
+};
+
+/**
+ * @struct InputCommand
+ * @brief һ
+ *
+ * ֻ¼ ID ¼ͼָ룬ִʱͼѱ
+ */
+struct InputCommand {
+    InputCommandType type;  ///< 
+    int cardId;             ///< Ŀ IDICT_CARD_TAPĿʷڵ IDICT_HISTORY_JUMP
+};
+
+/**
+ * @class InputCommandQueue
+ * @brief 
+ *
+ * ְ
+ * - ˳򻺴룬֤ϸִ
+ * - ڼ벻ٱ
+ *
+ * ʹó
+ * Ϊ GameController ĳԱصֻӣ GameController ͳһִ
+ *
+ * ԭ
+ * - 飬ӳӲڴ
+ * - ֻ洢ҵ߼
+ */
+class InputCommandQueue {
+public:
+    static const int kCapacity = 64;  ///< 
+
+    InputCommandQueue();
+
+    /**
+     * @brief 
+     * @param command 
+     * @return  false
+     */
+    bool push(const InputCommand& command);
+
+    /**
+     * @brief 
+     * @param outCommand 洢ӵ
+     * @return Ϊշ false
+     */
+    bool pop(InputCommand& outCommand);
+
+    /**
+     * @brief ն
+     */
+    void clear();
+
+    bool isEmpty() const { return _count == 0; }
+    int size() const { return _count; }
+
+private:
+    InputCommand _commands[kCapacity];  ///< λ
+    int _head;                          ///< ±
+    int _count;                         ///< ǰ
+};
+
+#endif
@@ -0,0 +1,231 @@
+// Classes/managers/TelemetryRecorder.cpp
+#include "TelemetryRecorder.h"
+#include "utils/Logger.h"
+#include <algorithm>
+#include <cstdio>
+#include <zlib.h>
+
+static_assert(sizeof(TelemetryRecord) == 16, "TelemetryRecord is a fixed 16-byte on-disk record");
+static_assert(sizeof(TelemetryBatchHeader) == 20, "TelemetryBatchHeader is a fixed 20-byte on-disk header");
+static_assert((TelemetryRecorder::kCapacity & (TelemetryRecorder::kCapacity - 1)) == 0,
+              "TelemetryRecorder::kCapacity must be a power of two");
+
+TelemetryRecorder::TelemetryRecorder(const std::string& path)
+    : _path(path)
+    , _head(0)
+    , _tail(0)
+    , _dropped(0)
+    , _signalledHead(0)
+    , _undoCount(0)
+    , _hasLastEvent(false)
+    , _recordedCount(0)
+    , _maxEventNs(0)
+    , _overBudgetCount(0)
+    , _droppedWritten(0)
+    , _flushRequested(false)
+    , _stopping(false) {
+    // д̵߳Ļһη䵽֮ٷ
+    _staging.reserve(kCapacity);
+    _compressed.resize(compressBound(kCapacity * sizeof(TelemetryRecord)));
+    _writer = std::thread(&TelemetryRecorder::writerLoop, this);
+}
+
+TelemetryRecorder::~TelemetryRecorder() {
+    {
+        std::lock_guard<std::mutex> lock(_wakeMutex);
+        _stopping = true;
+    }
+    _wake.notify_one();
+    if (_writer.joinable()) _writer.join();
+}
+
+void TelemetryRecorder::record(TelemetryEventType type, uint32_t value, int cardsRemaining, int stockCount) {
+    auto now = std::chrono::steady_clock::now();
+
+    // ؼڻ£ʹ¼֮ļ¼ҲȷĹؿۼ
+    if (type == TET_LEVEL_START) _undoCount = 0;
+    else if (type == TET_UNDO && _undoCount < UINT16_MAX) _undoCount++;
+
+    uint64_t head = _head.load(std::memory_order_relaxed);
+    if (head - _tail.load(std::memory_order_acquire) >= (uint64_t)kCapacity) {
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    int64_t elapsedMs = _hasLastEvent
+        ? std::chrono::duration_cast<std::chrono::milliseconds>(now - _lastEventTime).count() : 0;
+    _lastEventTime = now;
+    _hasLastEvent = true;
+
+    TelemetryRecord& record = _ring[head & (kCapacity - 1)];
+    record.elapsedMs = (uint32_t)std::min<int64_t>(elapsedMs, UINT32_MAX);
+    record.value = value;
+    record.type = (uint8_t)type;
+    record.reserved = 0;
+    record.cardsRemaining = (uint16_t)std::min(std::max(cardsRemaining, 0), (int)UINT16_MAX);
+    record.stockCount = (uint16_t)std::min(std::max(stockCount, 0), (int)UINT16_MAX);
+    record.undoCount = _undoCount;
+    _head.store(head + 1, std::memory_order_release);
+    _recordedCount++;
+
+    // һŻд̣߳ѵĿ̯ÿ¼ϲ 1/kBatchRecords μ
+    if (head + 1 - _signalledHead >= (uint64_t)kBatchRecords) {
+        _signalledHead = head + 1;
+        flush();
+    }
+
+#if defined(COCOS2D_DEBUG) && COCOS2D_DEBUG > 0
+    int64_t costNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - now).count();
+    if (costNs > _maxEventNs) _maxEventNs = costNs;
+    if (costNs > kEventBudgetNs) _overBudgetCount++;
+#endif
+}
+
+void TelemetryRecorder::flush() {
+    {
+        std::lock_guard<std::mutex> lock(_wakeMutex);
+        _flushRequested = true;
+    }
+    _wake.notify_one();
+    _signalledHead = _head.load(std::memory_order_relaxed);
+}
+
+void TelemetryRecorder::logStats() const {
+#if defined(COCOS2D_DEBUG) && COCOS2D_DEBUG > 0
+    CM_LOG_INFO(LC_PERF, "Telemetry: %llu events, %u dropped, max %lld ns per event (budget %lld ns, %llu over)",
+                (unsigned long long)_recordedCount, _dropped.load(std::memory_order_relaxed),
+                (long long)_maxEventNs, (long long)kEventBudgetNs, (unsigned long long)_overBudgetCount);
+#else
+    CM_LOG_INFO(LC_PERF, "Telemetry: %llu events, %u dropped",
+                (unsigned long long)_recordedCount, _dropped.load(std::memory_order_relaxed));
+#endif
+}
+
+void TelemetryRecorder::writerLoop() {
+    std::unique_lock<std::mutex> lock(_wakeMutex);
+    for (;;) {
+        _wake.wait(lock, [this]() { return _flushRequested || _stopping; });
+        bool stopping = _stopping;
+        _flushRequested = false;
+
+        lock.unlock();
+        writeBatch();
+        lock.lock();
+
+        if (stopping) break;
+    }
+}
+
+void TelemetryRecorder::writeBatch() {
+    uint64_t tail = _tail.load(std::memory_order_relaxed);
+    uint64_t head = _head.load(std::memory_order_acquire);
+    uint32_t droppedTotal = _dropped.load(std::memory_order_relaxed);
+    uint32_t dropped = droppedTotal - _droppedWritten;
+    if (head == tail && dropped == 0) return;
+    _droppedWritten = droppedTotal;
+
+    _staging.clear();
+    for (uint64_t i = tail; i < head; i++) {
+        _staging.push_back(_ring[i & (kCapacity - 1)]);
+    }
+    _tail.store(head, std::memory_order_release);
+
+    uLong rawBytes = (uLong)(_staging.size() * sizeof(TelemetryRecord));
+    uLongf compressedBytes = (uLongf)_compressed.size();
+    if (rawBytes > 0 && compress2(_compressed.data(), &compressedBytes, (const Bytef*)_staging.data(), rawBytes,
+                                  Z_DEFAULT_COMPRESSION) != Z_OK) {
+        CM_LOG_WARN(LC_GAME, "Telemetry: compression failed, %u records lost", (unsigned)_staging.size());
+        return;
+    }
+    if (rawBytes == 0) compressedBytes = 0;
+
+    TelemetryBatchHeader header;
+    header.magic = kBatchMagic;
+    header.version = kFormatVersion;
+    header.recordSize = (uint16_t)sizeof(TelemetryRecord);
+    header.recordCount = (uint32_t)_staging.size();
+    header.compressedBytes = (uint32_t)compressedBytes;
+    header.droppedCount = dropped;
+
+    FILE* file = fopen(_path.c_str(), "ab");
+    if (!file) {
+        CM_LOG_WARN(LC_GAME, "Telemetry: cannot open %s", _path);
+        return;
+    }
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1
+        && (compressedBytes == 0 || fwrite(_compressed.data(), compressedBytes, 1, file) == 1);
+    long fileBytes = ftell(file);
+    fclose(file);
+
+    if (!ok) {
+        CM_LOG_WARN(LC_GAME, "Telemetry: write to %s failed", _path);
+        return;
+    }
+    CM_LOG_DEBUG(LC_GAME, "Telemetry: %u records, %lu -> %lu bytes", header.recordCount,
+                 (unsigned long)rawBytes, (unsigned long)compressedBytes);
+
+    if (fileBytes > kMaxFileBytes) rotateIfNeeded();
+}
+
+void TelemetryRecorder::rotateIfNeeded() {
+    std::string previous = _path + ".1";
+    remove(previous.c_str());
+    if (rename(_path.c_str(), previous.c_str()) != 0) {
+        CM_LOG_WARN(LC_GAME, "Telemetry: cannot rotate %s", _path);
+    }
+}
+
+bool TelemetryRecorder::readFile(const std::string& path, std::vector<TelemetryRecord>& outRecords,
+                                 uint64_t& outDropped) {
+    outDropped = 0;
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file) return false;
+
+    bool ok = true;
+    std::vector<unsigned char> compressed;
+    for (;;) {
+        TelemetryBatchHeader header;
+        size_t read = fread(&header, 1, sizeof(header), file);
+        if (read == 0) break;
+        if (read != sizeof(header) || header.magic != kBatchMagic || header.version > kFormatVersion
+            || header.recordSize != sizeof(TelemetryRecord) || header.recordCount > (uint32_t)kCapacity) {
+            ok = false;
+            break;
+        }
+
+        compressed.resize(header.compressedBytes);
+        if (header.compressedBytes > 0 && fread(compressed.data(), header.compressedBytes, 1, file) != 1) {
+            // д;ֹһ
+            ok = false;
+            break;
+        }
+        outDropped += header.droppedCount;
+        if (header.recordCount == 0) continue;
+
+        size_t start = outRecords.size();
+        outRecords.resize(start + header.recordCount);
+        uLongf rawBytes = (uLongf)(header.recordCount * sizeof(TelemetryRecord));
+        if (uncompress((Bytef*)&outRecords[start], &rawBytes, compressed.data(), header.compressedBytes) != Z_OK
+            || rawBytes != header.recordCount * sizeof(TelemetryRecord)) {
+            outRecords.resize(start);
+            ok = false;
+            break;
+        }
+    }
+
+    fclose(file);
+    return ok;
+}
+
+const char* TelemetryRecorder::getTypeName(int type) {
+    switch (type) {
+    case TET_LEVEL_START: return "level_start";
+    case TET_CARD_TAP: return "card_tap";
+    case TET_MISMATCH: return "mismatch";
+    case TET_STOCK_DRAW: return "stock_draw";
+    case TET_UNDO: return "undo";
+    case TET_GAME_OVER: return "game_over";
+    default: return "unknown";
+    }
+}
@@ -0,0 +1,166 @@
+// Classes/managers/TelemetryRecorder.h
+#ifndef __TELEMETRY_RECORDER_H__
+#define __TELEMETRY_RECORDER_H__
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @enum TelemetryEventType
+ * @brief ң¼
+ */
+enum TelemetryEventType {
+    TET_LEVEL_START = 1,   ///< ʼһأvalue Ϊؿʶؿǩ޾ģʽӵĵ 32 λ
+    TET_CARD_TAP,          ///< ϷƳƣvalue Ϊ ID
+    TET_MISMATCH,          ///< ĿƲܳƣvalue Ϊ ID
+    TET_STOCK_DRAW,        ///< ӱƶѳ
+    TET_UNDO,              ///< һ
+    TET_GAME_OVER          ///< Ծֽvalue Ϊ 1 ʤ0 ʧ
+};
+
+/**
+ * @struct TelemetryRecord
+ * @brief һң¼ 16 ֽڣСֽԭдļ
+ */
+struct TelemetryRecord {
+    uint32_t elapsedMs;        ///< һ¼ĺĵһΪ 0
+    uint32_t value;            ///< ¼Ͷ TelemetryEventType
+    uint8_t type;              ///< TelemetryEventType
+    uint8_t reserved;
+    uint16_t cardsRemaining;   ///< ¼ϷʣĿ
+    uint16_t stockCount;       ///< ¼ƶѵ
+    uint16_t undoCount;        ///< ۼƳ
+};
+
+/**
+ * @struct TelemetryBatchHeader
+ * @brief ļÿһ¼ͷ֮ compressedBytes ֽڵ zlib 
+ */
+struct TelemetryBatchHeader {
+    uint32_t magic;             ///< kBatchMagic
+    uint16_t version;           ///< kFormatVersion
+    uint16_t recordSize;        ///< sizeof(TelemetryRecord)
+    uint32_t recordCount;       ///< ¼
+    uint32_t compressedBytes;   ///< ѹֽ
+    uint32_t droppedCount;      ///< һ֮򻺳дļ¼
+};
+
+/**
+ * @class TelemetryRecorder
+ * @brief ضԾң¼
+ *
+ * ְ
+ * - ¼ÿһ͡һʱ䡢Ϸʣ࿨ƶͱس
+ * - ¼дڴ滷λ壬̨̰߳ȡ zlib ѹ׷ӵļ
+ * - ṩȡļľ̬߽빤ߣtools/telemetry_decodeʹ
+ *
+ * ʹó
+ * GameController ڿ֡ơơͶԾֽʱ record
+ * ؿԾֽе̨ʱ flush
+ *
+ * ԭ
+ * - ÿ¼ĿޣkEventBudgetNsֻдһ¼ڴ桢 IO
+ *   Debug ÿ record ĺʱ޵Ĵ logStats 
+ * - ߣ̣߳ߣд̣߳Ļλ壬дʱ¼¼дһͷ
+ * - дֻ߳ڻһʽ flush ʱѣƽʱѯ
+ * - ļ kMaxFileBytes ʱΪ <ļ>.1 ¿ʼౣ
+ */
+class TelemetryRecorder {
+public:
+    static const uint32_t kBatchMagic = 0x42544d43;     ///< "CMTB"
+    static const uint16_t kFormatVersion = 1;
+    static const int kCapacity = 1024;                  ///< λļ¼2 ݣ
+    static const int kBatchRecords = 256;               ///< ۵ô¼ʱд߳
+    static const int64_t kEventBudgetNs = 200;          ///< ÿ¼ĺʱ
+    static const long kMaxFileBytes = 4 * 1024 * 1024;  ///< ļĴС
+
+    /**
+     * @param path ңļ·׷д룩
+     */
+    explicit TelemetryRecorder(const std::string& path);
+
+    /**
+     * @brief дʣ¼ֹͣд߳
+     */
+    ~TelemetryRecorder();
+
+    /**
+     * @brief ¼һ¼̵߳ã
+     * @param type ¼
+     * @param value ¼Ͷֵ
+     * @param cardsRemaining Ϸʣ࿨
+     * @param stockCount ƶ
+     */
+    void record(TelemetryEventType type, uint32_t value, int cardsRemaining, int stockCount);
+
+    /**
+     * @brief д߳дем¼ȴдɣ̵߳ã
+     */
+    void flush();
+
+    /**
+     * @brief һͳ־¼͵¼ʱ̵߳ã
+     */
+    void logStats() const;
+
+    /**
+     * @brief ȡңļ
+     * @param path ļ·
+     * @param outRecords д˳׷м¼
+     * @param outDropped дʱļ¼
+     * @return ļ޷򿪻ʽ󷵻 falseѶļ¼ outRecords 
+     */
+    static bool readFile(const std::string& path, std::vector<TelemetryRecord>& outRecords, uint64_t& outDropped);
+
+    /**
+     * @brief ¼
+     */
+    static const char* getTypeName(int type);
+
+private:
+    void writerLoop();
+
+    /**
+     * @brief ȡем¼ѹ׷ӵļд̣߳
+     */
+    void writeBatch();
+
+    /**
+     * @brief ļСʱֻ
+     */
+    void rotateIfNeeded();
+
+    std::string _path;
+    TelemetryRecord _ring[kCapacity];
+    std::atomic<uint64_t> _head;          ///< һдλã߳д
+    std::atomic<uint64_t> _tail;          ///< һȡλãд߳д
+    std::atomic<uint32_t> _dropped;       ///< ļ¼
+
+    // ̷߳
+    uint64_t _signalledHead;              ///< ϴλд߳ʱдλ
+    uint16_t _undoCount;                  ///< ۼƳ
+    bool _hasLastEvent;
+    std::chrono::steady_clock::time_point _lastEventTime;
+    uint64_t _recordedCount;              ///< ¼¼
+    int64_t _maxEventNs;                  ///< ¼ʱ Debug 
+    uint64_t _overBudgetCount;            ///< ʱ޵¼ Debug 
+
+    // д߳ʹãҪͬ
+    uint32_t _droppedWritten;                    ///< дͷĶ
+    std::vector<TelemetryRecord> _staging;       ///< ѹļ¼
+    std::vector<unsigned char> _compressed;      ///< ѹ
+
+    std::mutex _wakeMutex;
+    std::condition_variable _wake;
+    bool _flushRequested;
+    bool _stopping;
+    std::thread _writer;
+};
+
+#endif
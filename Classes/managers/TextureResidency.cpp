@@ -0,0 +1,163 @@
+// Classes/managers/TextureResidency.cpp
+#include "TextureResidency.h"
+#include "utils/Logger.h"
+#include <algorithm>
+
+USING_NS_CC;
+
+const size_t TextureResidency::kDefaultBudget = 48 * 1024 * 1024;
+
+namespace {
+    float toMegabytes(size_t bytes) {
+        return (float)bytes / (1024.0f * 1024.0f);
+    }
+}
+
+TextureResidency* TextureResidency::getInstance() {
+    static TextureResidency instance;
+    return &instance;
+}
+
+TextureResidency::TextureResidency() {
+    _stats.currentBytes = 0;
+    _stats.peakBytes = 0;
+    _stats.budgetBytes = kDefaultBudget;
+    _stats.textureCount = 0;
+    _stats.evictedCount = 0;
+}
+
+void TextureResidency::setBudget(size_t bytes) {
+    _stats.budgetBytes = bytes;
+}
+
+void TextureResidency::pushScope(const std::string& name) {
+    if ((int)_scopes.size() == kMaxScopes) {
+        CM_LOG_WARN(LC_ASSET, "TextureResidency: scope stack full, '%s' shares the innermost scope", name.c_str());
+    }
+    _scopes.push_back(name);
+}
+
+void TextureResidency::popScope() {
+    if (_scopes.empty()) return;
+
+    // ջȵڲ㹲һλֻеڲ㱾ʱͷ
+    if ((int)_scopes.size() <= kMaxScopes) {
+        uint32_t bit = currentScopeBit();
+        for (auto& entry : _lru) {
+            entry.scopeMask &= ~bit;
+        }
+    }
+    _scopes.pop_back();
+}
+
+uint32_t TextureResidency::currentScopeBit() const {
+    if (_scopes.empty()) return 0u;
+    return 1u << (std::min((int)_scopes.size(), kMaxScopes) - 1);
+}
+
+Texture2D* TextureResidency::acquire(const std::string& path) {
+    auto textureCache = Director::getInstance()->getTextureCache();
+
+    auto found = _index.find(path);
+    if (found != _index.end()) {
+        Texture2D* texture = textureCache->getTextureForKey(path);
+        if (texture) {
+            found->second->scopeMask |= currentScopeBit();
+            _lru.splice(_lru.begin(), _lru, found->second);
+            return texture;
+        }
+        // ڱ𴦱Ƴ TextureCache
+        erase(found->second);
+    }
+
+    Texture2D* texture = textureCache->addImage(path);
+    if (texture) registerTexture(path, texture);
+    return texture;
+}
+
+Texture2D* TextureResidency::acquireDecoded(const std::string& path, const std::string& fullPath, Image* image) {
+    if (_index.count(path) > 0) return acquire(path);
+
+    // ·Ϊϴ֮ Sprite::create(path)  acquire(path) 
+    Texture2D* texture = Director::getInstance()->getTextureCache()->addImage(image, fullPath);
+    if (texture) registerTexture(path, texture);
+    return texture;
+}
+
+void TextureResidency::registerTexture(const std::string& path, Texture2D* texture) {
+    Entry entry;
+    entry.path = path;
+    entry.bytes = textureBytes(texture);
+    entry.scopeMask = currentScopeBit();
+    _lru.push_front(entry);
+    _index[path] = _lru.begin();
+
+    _stats.currentBytes += entry.bytes;
+    _stats.peakBytes = std::max(_stats.peakBytes, _stats.currentBytes);
+    _stats.textureCount++;
+
+    if (_stats.currentBytes > _stats.budgetBytes) {
+        trim();
+    }
+}
+
+Sprite* TextureResidency::createSprite(const std::string& path) {
+    Texture2D* texture = acquire(path);
+    return texture ? Sprite::createWithTexture(texture) : nullptr;
+}
+
+void TextureResidency::setSpriteTexture(Sprite* sprite, const std::string& path) {
+    if (!sprite) return;
+
+    Texture2D* texture = acquire(path);
+    if (!texture) return;
+    sprite->setTexture(texture);
+    sprite->setTextureRect(Rect(Vec2::ZERO, texture->getContentSize()));
+}
+
+int TextureResidency::trim() {
+    auto textureCache = Director::getInstance()->getTextureCache();
+    int evicted = 0;
+
+    // δõһǰͷǸʹõ
+    auto it = _lru.end();
+    while (_stats.currentBytes > _stats.budgetBytes && it != _lru.begin()) {
+        --it;
+        if (it == _lru.begin()) break;
+        if (it->scopeMask != 0) continue;
+
+        Texture2D* texture = textureCache->getTextureForKey(it->path);
+        if (texture && texture->getReferenceCount() > 1) continue;   // о
+
+        if (texture) {
+            textureCache->removeTexture(texture);
+            evicted++;
+        }
+        it = erase(it);
+    }
+
+    _stats.evictedCount += evicted;
+    if (_stats.currentBytes > _stats.budgetBytes) {
+        CM_LOG_WARN(LC_ASSET, "TextureResidency: %.1f MB in use exceeds the %.1f MB budget",
+              toMegabytes(_stats.currentBytes), toMegabytes(_stats.budgetBytes));
+    }
+    return evicted;
+}
+
+void TextureResidency::logStats(const char* reason) const {
+    CM_LOG_INFO(LC_ASSET, "Texture memory (%s): %.1f MB in %d textures, peak %.1f MB, budget %.1f MB, %d evicted",
+          reason, toMegabytes(_stats.currentBytes), _stats.textureCount,
+          toMegabytes(_stats.peakBytes), toMegabytes(_stats.budgetBytes), _stats.evictedCount);
+}
+
+std::list<TextureResidency::Entry>::iterator TextureResidency::erase(std::list<Entry>::iterator it) {
+    _stats.currentBytes -= it->bytes;
+    _stats.textureCount--;
+    _index.erase(it->path);
+    return _lru.erase(it);
+}
+
+size_t TextureResidency::textureBytes(Texture2D* texture) {
+    return (size_t)texture->getPixelsWide() * (size_t)texture->getPixelsHigh()
+        * texture->getBitsPerPixelForFormat() / 8;
+}
@@ -0,0 +1,149 @@
+// Classes/managers/TextureResidency.h
+#ifndef __TEXTURE_RESIDENCY_H__
+#define __TEXTURE_RESIDENCY_H__
+
+#include "cocos2d.h"
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @struct TextureMemoryStats
+ * @brief  TextureResidency ռõԴ
+ */
+struct TextureMemoryStats {
+    size_t currentBytes;   ///< ǰפֽ
+    size_t peakBytes;      ///< ķֵֽ
+    size_t budgetBytes;    ///< Ԥֽ
+    int textureCount;      ///< ǰפ
+    int evictedCount;      ///< 
+};
+
+/**
+ * @class TextureResidency
+ * @brief ԴԤפ
+ *
+ * ְ
+ * -  Sprite::create(path) ԤõͼƬ¼ÿԴռúʹ˳
+ * - 򣨳ؿ⣩Ǽãʱͷ
+ * - Ԥʱδõ˳ TextureCache ʹõ浱ǰͷֵռ
+ *
+ * ʹó
+ * CardViewGameView ͨ createSprite / setSpriteTexture ͻÿơ飻
+ * GameController ʱѹ볡͹ؿؿؿʱµĹؿȾ¹ؿ trim
+ *
+ * ԭ
+ * - ֻͬʱûãҳ TextureCache ûо
+ * - ͷʱԤڵ棬һʱ½
+ * - ڱ֮塢RenderTexture ȣͳ
+ */
+class TextureResidency {
+public:
+    static const size_t kDefaultBudget;   ///< ĬԤ㣨ֽڣͶ Android ͵
+    static const int kMaxScopes = 32;     ///< ֱ¼õ 32 㹲
+
+    static TextureResidency* getInstance();
+
+    /**
+     * @brief ԴԤ
+     * @param bytes Ԥֽ
+     */
+    void setBudget(size_t bytes);
+
+    /**
+     * @brief ѹһ֮ʹõǼǵ
+     * @param name ƣ־
+     */
+    void pushScope(const std::string& name);
+
+    /**
+     * @brief ڲͷǼǵ
+     * @details  trim
+     */
+    void popScope();
+
+    /**
+     * @brief Ǽǵǰ
+     * @param path ͼƬ·
+     * @return ʧܷ nullptr
+     */
+    cocos2d::Texture2D* acquire(const std::string& path);
+
+    /**
+     * @brief ϴһڹ߳̽õͼƬǼǵǰ
+     * @param path ͼƬ·֮ acquire ʹõ·
+     * @param fullPath ·TextureCache ļ
+     * @param image 
+     * @return ѵǼǹ·ֱӷ
+     * @details ̵߳ã AssetPreloader ʹ
+     */
+    cocos2d::Texture2D* acquireDecoded(const std::string& path, const std::string& fullPath, cocos2d::Image* image);
+
+    /**
+     * @brief  acquire 
+     * @return 飬ʧܷ nullptr Sprite::create(path) һ£
+     */
+    cocos2d::Sprite* createSprite(const std::string& path);
+
+    /**
+     * @brief 滻Ϊͼ Sprite::setTexture(path) һ£
+     */
+    void setSpriteTexture(cocos2d::Sprite* sprite, const std::string& path);
+
+    /**
+     * @brief Ԥʱδõ˳δʹõ
+     * @return 
+     */
+    int trim();
+
+    /**
+     * @brief ǰԴͳ
+     */
+    const TextureMemoryStats& getStats() const { return _stats; }
+
+    /**
+     * @brief һԴͳ־
+     * @param reason ԭ "level loaded"
+     */
+    void logStats(const char* reason) const;
+
+private:
+    /**
+     * @struct Entry
+     * @brief һפ
+     */
+    struct Entry {
+        std::string path;      ///< ʱʹõ·TextureCache ĲҼ
+        size_t bytes;          ///< Դռ
+        uint32_t scopeMask;    ///< 򣬰ջȡλ
+    };
+
+    TextureResidency();
+
+    /**
+     * @brief Ƴһ¼ͳ
+     * @return еһ¼
+     */
+    std::list<Entry>::iterator erase(std::list<Entry>::iterator it);
+
+    /**
+     * @brief Ϊ¼Ԥʱ
+     */
+    void registerTexture(const std::string& path, cocos2d::Texture2D* texture);
+
+    /**
+     * @brief ǰӦλûʱΪ 0
+     */
+    uint32_t currentScopeBit() const;
+
+    static size_t textureBytes(cocos2d::Texture2D* texture);
+
+    std::list<Entry> _lru;                                                  ///< פʹõǰ
+    std::unordered_map<std::string, std::list<Entry>::iterator> _index;    ///< ·¼
+    std::vector<std::string> _scopes;                                       ///< ջ
+    TextureMemoryStats _stats;
+};
+
+#endif
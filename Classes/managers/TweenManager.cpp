@@ -0,0 +1,197 @@
+// Classes/managers/TweenManager.cpp
+#include "TweenManager.h"
+#include "utils/Logger.h"
+#include "utils/TraceProfiler.h"
+#include <algorithm>
+
+USING_NS_CC;
+
+//  ID ĵ 8 λǲλ±
+static_assert(TweenManager::kMaxTweens <= 256, "tween slot must fit in 8 bits");
+
+TweenManager::TweenManager()
+    : _freeCount(0)
+    , _activeCount(0)
+    , _completionCount(0) {
+    for (int i = 0; i < kMaxTweens; i++) {
+        _tweens[i].node = nullptr;
+        _tweens[i].generation = 0;
+        _tweens[i].next = -1;
+        // ջȷ±Ĳλ
+        _freeSlots[_freeCount++] = kMaxTweens - 1 - i;
+    }
+}
+
+TweenManager::~TweenManager() {
+    cancelAll();
+}
+
+int TweenManager::allocate(Node* node, const Vec2& target, float duration, TweenEase ease) {
+    if (_freeCount == 0) return -1;
+
+    int slot = _freeSlots[--_freeCount];
+    Tween& tween = _tweens[slot];
+    tween.node = node;
+    tween.from = node->getPosition();
+    tween.to = target;
+    tween.elapsed = 0.0f;
+    tween.duration = duration;
+    tween.ease = ease;
+    tween.next = -1;
+    tween.listener = nullptr;
+    tween.userData = 0;
+    node->retain();
+    return slot;
+}
+
+void TweenManager::release(int slot) {
+    Tween& tween = _tweens[slot];
+    tween.node->release();
+    tween.node = nullptr;
+    tween.next = -1;
+    tween.generation = (tween.generation + 1) & 0x7FFFFF;
+    _freeSlots[_freeCount++] = slot;
+}
+
+void TweenManager::start(int slot) {
+    Tween& tween = _tweens[slot];
+    tween.from = tween.node->getPosition();
+    _active[_activeCount++] = slot;
+}
+
+int TweenManager::slotOf(int tweenId) const {
+    if (tweenId < 0) return -1;
+    int slot = tweenId & 0xFF;
+    if (slot >= kMaxTweens || !_tweens[slot].node || makeId(slot) != tweenId) return -1;
+    return slot;
+}
+
+int TweenManager::moveTo(Node* node, const Vec2& target, float duration, TweenEase ease) {
+    if (!node) return -1;
+
+    int slot = allocate(node, target, duration, ease);
+    if (slot < 0) {
+        CM_LOG_WARN(LC_RENDER, "TweenManager full, tween skipped");
+        node->setPosition(target);
+        return -1;
+    }
+    start(slot);
+    return makeId(slot);
+}
+
+int TweenManager::then(int tweenId, const Vec2& target, float duration, TweenEase ease) {
+    int last = slotOf(tweenId);
+    if (last < 0) return -1;
+    while (_tweens[last].next >= 0) {
+        last = _tweens[last].next;
+    }
+
+    int slot = allocate(_tweens[last].node, target, duration, ease);
+    if (slot < 0) return -1;
+    _tweens[last].next = slot;
+    return makeId(slot);
+}
+
+void TweenManager::setCompletion(int tweenId, TweenListener* listener, int userData) {
+    int slot = slotOf(tweenId);
+    if (slot < 0) return;
+    _tweens[slot].listener = listener;
+    _tweens[slot].userData = userData;
+}
+
+void TweenManager::cancel(Node* node) {
+    // ѵյ㡢ȴ¼Ĳ䣺ͷŲλ¼ ID ʧЧ
+    for (int i = 0; i < _completionCount; i++) {
+        int slot = slotOf(_completions[i].tweenId);
+        if (slot >= 0 && _tweens[slot].node == node) release(slot);
+    }
+
+    for (int i = _activeCount - 1; i >= 0; i--) {
+        int slot = _active[i];
+        if (_tweens[slot].node != node) continue;
+
+        _active[i] = _active[--_activeCount];
+        while (slot >= 0) {
+            int next = _tweens[slot].next;
+            release(slot);
+            slot = next;
+        }
+    }
+}
+
+void TweenManager::cancelAll() {
+    while (_activeCount > 0) {
+        cancel(_tweens[_active[0]].node);
+    }
+    for (int i = 0; i < _completionCount; i++) {
+        int slot = slotOf(_completions[i].tweenId);
+        if (slot >= 0) release(slot);
+    }
+}
+
+bool TweenManager::isAnimating(Node* node) const {
+    for (int i = 0; i < _activeCount; i++) {
+        if (_tweens[_active[i]].node == node) return true;
+    }
+    return false;
+}
+
+void TweenManager::update(float dt) {
+    CM_TRACE_SCOPE("TweenManager::update");
+    _completionCount = 0;
+
+    // ĲĩβƳ֡¿ʼĴ׷ĩβڱ֡ƽ
+    for (int i = _activeCount - 1; i >= 0; i--) {
+        int slot = _active[i];
+        Tween& tween = _tweens[slot];
+
+        tween.elapsed += dt;
+        float progress = tween.duration > 0.0f ? std::min(tween.elapsed / tween.duration, 1.0f) : 1.0f;
+        tween.node->setPosition(tween.from + (tween.to - tween.from) * applyEase(tween.ease, progress));
+        if (progress < 1.0f) continue;
+
+        _active[i] = _active[--_activeCount];
+        int next = tween.next;
+        tween.next = -1;
+        if (next >= 0) start(next);
+
+        if (tween.listener) {
+            // λ¼ڼɱȡ
+            Completion& completion = _completions[_completionCount++];
+            completion.tweenId = makeId(slot);
+            completion.listener = tween.listener;
+            completion.userData = tween.userData;
+        }
+        else {
+            release(slot);
+        }
+    }
+
+    // ¼вƽ󷢳շ԰ȫȡ䣻
+    // ֮֡ǰĻصȡĲ ID ʧЧٷ
+    for (int i = 0; i < _completionCount; i++) {
+        const Completion& completion = _completions[i];
+        int slot = slotOf(completion.tweenId);
+        if (slot < 0) continue;
+        release(slot);
+        completion.listener->onTweenFinished(completion.userData);
+    }
+    _completionCount = 0;
+}
+
+float TweenManager::applyEase(TweenEase ease, float t) {
+    switch (ease) {
+    case TE_QUAD_OUT:
+        return 1.0f - (1.0f - t) * (1.0f - t);
+    case TE_QUAD_IN_OUT:
+        return t < 0.5f ? 2.0f * t * t : 1.0f - 2.0f * (1.0f - t) * (1.0f - t);
+    case TE_BACK_OUT: {
+        const float overshoot = 1.70158f;
+        float u = t - 1.0f;
+        return u * u * ((overshoot + 1.0f) * u + overshoot) + 1.0f;
+    }
+    case TE_LINEAR:
+    default:
+        return t;
+    }
+}
@@ -0,0 +1,179 @@
+// Classes/managers/TweenManager.h
+#ifndef __TWEEN_MANAGER_H__
+#define __TWEEN_MANAGER_H__
+
+#include "cocos2d.h"
+
+/**
+ * @enum TweenEase
+ * @brief 仺
+ */
+enum TweenEase {
+    TE_LINEAR,        ///< 
+    TE_QUAD_OUT,      ///< ȿ
+    TE_QUAD_IN_OUT,   ///< м
+    TE_BACK_OUT       ///< ΢Խյٻص
+};
+
+/**
+ * @class TweenListener
+ * @brief ¼Ľշ
+ */
+class TweenListener {
+public:
+    virtual ~TweenListener() {}
+
+    /**
+     * @brief 䲥ŵյ
+     * @param userData ¼ʱ
+     * @details  TweenManager::update вãصпȡ䣻
+     *          ͬһ֡б֮ǰĻصȡĲ䲻ٷ¼
+     */
+    virtual void onTweenFinished(int userData) = 0;
+};
+
+/**
+ * @class TweenManager
+ * @brief ػλòϵͳ
+ *
+ * ְ
+ * - ѽڵӵǰλƶĿλãֻ֧¼
+ * - ÿ֡һѭƽнеĲ
+ *
+ * ʹó
+ *  GameView вÿ֡£StackController ĿƷк GameController Ĳƥ䶶
+ * ͨţÿ½ Sequence / MoveTo / MoveBy / CallFunc
+ *
+ * ԭ
+ * - ¼ڶУеĲ±Уͽڴ
+ * -  ID λú ID ԶʧЧ
+ * - ʱֱӰѽڵŵյ㣬ֽ̲ж
+ */
+class TweenManager {
+public:
+    static const int kMaxTweens = 128;  ///< ͬʱڵĲޣȴĲ䣩
+
+    TweenManager();
+    ~TweenManager();
+
+    /**
+     * @brief һλò
+     * @param node Ŀڵ㣨ڼã
+     * @param target յλãڵ꣩
+     * @param duration ʱ룩 0 ʱһ update ֱ
+     * @param ease 
+     * @return  IDʱ -1ʱڵѱŵյ㣬÷ɴ
+     * @details ȡڵ㵱ǰλ
+     */
+    int moveTo(cocos2d::Node* node, const cocos2d::Vec2& target, float duration, TweenEase ease = TE_LINEAR);
+
+    /**
+     * @brief һ֮µλò
+     * @param tweenId ǰһ ID
+     * @param target յλ
+     * @param duration ʱ룩
+     * @param ease 
+     * @return ² IDǰһѽʱ -1
+     * @details ²ǰһ䵽յʼȡڵ㵱ʱλ
+     */
+    int then(int tweenId, const cocos2d::Vec2& target, float duration, TweenEase ease = TE_LINEAR);
+
+    /**
+     * @brief ò¼
+     * @param tweenId  IDʱһϣ
+     * @param listener շУڲȡǰЧ
+     * @param userData ¼ص
+     */
+    void setCompletion(int tweenId, TweenListener* listener, int userData);
+
+    /**
+     * @brief ȡڵϵв䣨ȴĲͱ֡δ¼¼
+     * @param node Ŀڵ㣬ڵͣڵǰλ
+     */
+    void cancel(cocos2d::Node* node);
+
+    /**
+     * @brief ȡв䣬¼
+     */
+    void cancelAll();
+
+    /**
+     * @brief ڵǷнеĲ
+     */
+    bool isAnimating(cocos2d::Node* node) const;
+
+    /**
+     * @brief еĲȴĲ䣩
+     */
+    int getActiveCount() const { return _activeCount; }
+
+    /**
+     * @brief ƽнеĲ䣬֡¼
+     * @param dt ֡
+     */
+    void update(float dt);
+
+private:
+    /**
+     * @struct Tween
+     * @brief һ¼
+     */
+    struct Tween {
+        cocos2d::Node* node;        ///< Ŀڵ㣨ãnullptr ʾвλ
+        cocos2d::Vec2 from;         ///< 㣬ʼʱȷ
+        cocos2d::Vec2 to;           ///< յ
+        float elapsed;              ///< Ѳʱ
+        float duration;             ///< ʱ
+        TweenEase ease;             ///< 
+        int generation;             ///< λ
+        int next;                   ///< һβλ-1 ʾ
+        TweenListener* listener;    ///< ¼շ
+        int userData;               ///< ¼
+    };
+
+    /**
+     * @struct Completion
+     * @brief ֡¼
+     * @details յĲλ¼ʱͷţڼ䱻ȡ ID ʧЧ¼
+     */
+    struct Completion {
+        int tweenId;
+        TweenListener* listener;
+        int userData;
+    };
+
+    /**
+     * @brief ȡһвλü¼
+     * @return λ±꣬ -1
+     */
+    int allocate(cocos2d::Node* node, const cocos2d::Vec2& target, float duration, TweenEase ease);
+
+    /**
+     * @brief ͷŲλŻؿвλջ
+     */
+    void release(int slot);
+
+    /**
+     * @brief ʼŲλеĲ䲢б
+     */
+    void start(int slot);
+
+    /**
+     * @brief ɲ ID ҵλID ʧЧ -1
+     */
+    int slotOf(int tweenId) const;
+
+    int makeId(int slot) const { return (_tweens[slot].generation << 8) | slot; }
+
+    static float applyEase(TweenEase ease, float t);
+
+    Tween _tweens[kMaxTweens];                  ///< ¼
+    int _freeSlots[kMaxTweens];                 ///< вλջ
+    int _freeCount;                             ///< вλ
+    int _active[kMaxTweens];                    ///< еĲλУ
+    int _activeCount;                           ///< еĲ
+    Completion _completions[kMaxTweens];        ///< ֡¼
+    int _completionCount;                       ///< ֡¼
+};
+
+#endif
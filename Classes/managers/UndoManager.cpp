@@ -3,42 +3,209 @@
 
 USING_NS_CC;
 
-UndoManager::UndoManager() {}
+const int UndoManager::kReservedNodesPerCard;
+
+size_t UndoManager::getNodeStride() {
+    const size_t alignment = alignof(std::max_align_t);
+    return (sizeof(UndoNode) + alignment - 1) & ~(alignment - 1);
+}
+
+size_t UndoManager::getReservedBytes(int cardCount, int depthLimit) {
+    int nodeCount = depthLimit > 0 ? depthLimit + 2 : cardCount * kReservedNodesPerCard + 1;
+    return (size_t)nodeCount * getNodeStride() + alignof(std::max_align_t);
+}
+
+UndoManager::UndoManager()
+    : _arena(nullptr)
+    , _root(nullptr)
+    , _current(nullptr)
+    , _freeNodes(nullptr)
+    , _depthLimit(0)
+    , _keepBranches(true)
+    , _nextId(0)
+    , _allocatedCount(0)
+    , _recycledCount(0) {}
 
 UndoManager::~UndoManager() {
-    clear();
+    CC_SAFE_RELEASE(_arena);
+}
+
+void UndoManager::reset(ModelArena* arena, int depthLimit, bool keepBranches) {
+    CC_SAFE_RETAIN(arena);
+    CC_SAFE_RELEASE(_arena);
+    _arena = arena;
+
+    // ɽڵɾֵڴͷ
+    _root = _current = nullptr;
+    _freeNodes = nullptr;
+    _depthLimit = depthLimit > 0 ? depthLimit : 0;
+    _keepBranches = keepBranches;
+    _nextId = 0;
+    _allocatedCount = 0;
+    _recycledCount = 0;
+
+    _root = _current = createNode();
+}
+
+UndoNode* UndoManager::createNode() {
+    UndoNode* node = _freeNodes;
+    if (node) {
+        _freeNodes = node->nextSibling;
+        _recycledCount--;
+        *node = UndoNode();
+    }
+    else {
+        node = _arena ? _arena->allocateArray<UndoNode>(1) : nullptr;
+        if (!node) return nullptr;
+        _allocatedCount++;
+    }
+    node->id = _nextId++;
+    return node;
 }
 
-void UndoManager::pushStep(CardModel* movedCard, const Vec2& originalPos, CardModel* prevTop, bool fromStock) {
-    UndoStep step;
-    step.movedCard = movedCard;
-    step.originalPos = originalPos;
-    step.previousTopCard = prevTop;
-    step.isFromStock = fromStock;
+void UndoManager::recycleSubtree(UndoNode* node) {
+    if (!node) return;
+
+    // Ӹڵӽڵժ
+    if (node->parent) {
+        UndoNode** link = &node->parent->firstChild;
+        while (*link && *link != node) link = &(*link)->nextSibling;
+        if (*link) *link = node->nextSibling;
+    }
+
+    //  firstChild ½ժҶӽڵ㣬Ҫջ
+    UndoNode* cursor = node;
+    while (true) {
+        if (cursor->firstChild) {
+            cursor = cursor->firstChild;
+            continue;
+        }
+        UndoNode* parent = cursor->parent;
+        bool finished = (cursor == node);
+        if (!finished) parent->firstChild = cursor->nextSibling;
+
+        cursor->nextSibling = _freeNodes;
+        _freeNodes = cursor;
+        _recycledCount++;
+        if (finished) break;
+        cursor = parent;
+    }
+}
+
+void UndoManager::pushRecord(const MoveRecord& record) {
+    if (!record.isValid() || !_current) return;
+
+    if (_keepBranches) {
+        // еĽڵ֮ķ֧
+        for (UndoNode* child = _current->firstChild; child; child = child->nextSibling) {
+            if (child->type == record.type && child->card == record.card) {
+                child->stockCount = record.stockCount;
+                _current = child;
+                return;
+            }
+        }
+    }
+    else {
+        // ʷһ֧ٿɴ
+        while (_current->firstChild) {
+            recycleSubtree(_current->firstChild);
+        }
+    }
+
+    UndoNode* node = createNode();
+    if (!node) return;
 
-    // üֹԶ
-    if (step.movedCard) step.movedCard->retain();
-    if (step.previousTopCard) step.previousTopCard->retain();
+    node->depth = _current->depth + 1;
+    node->type = record.type;
+    node->card = record.card;
+    node->topBefore = record.topBefore;
+    node->cardPosition = record.cardPosition;
+    node->stockCount = record.stockCount;
+    node->parent = _current;
+    node->nextSibling = _current->firstChild;
+    _current->firstChild = node;
+    _current = node;
 
-    _undoStack.push_back(step);
+    if (_depthLimit > 0 && _current->depth - _root->depth > _depthLimit) {
+        pruneRoot();
+    }
 }
 
-bool UndoManager::popStep(UndoStep& outStep) {
-    if (_undoStack.empty()) return false;
+void UndoManager::pruneRoot() {
+    UndoNode* next = _current;
+    while (next->parent != _root) next = next->parent;
 
-    outStep = _undoStack.back();
-    _undoStack.pop_back();
+    // ǰ·ķ֧;ɸڵ
+    for (UndoNode* child = _root->firstChild; child; ) {
+        UndoNode* sibling = child->nextSibling;
+        if (child != next) recycleSubtree(child);
+        child = sibling;
+    }
+    _root->firstChild = nullptr;
+    recycleSubtree(_root);
+
+    next->parent = nullptr;
+    next->nextSibling = nullptr;
+    _root = next;
+}
 
-    // ע⣺ﵯ stepĶüڣҪɵߣControllerͷŻ¹
-    // Manager ֻջƳ releaseΪ Controller ҪЩָ״̬
+bool UndoManager::stepBack(MoveRecord& outRecord) {
+    if (!_current || _current == _root) return false;
 
+    outRecord = MoveRecord();
+    outRecord.type = _current->type;
+    outRecord.card = _current->card;
+    outRecord.topBefore = _current->topBefore;
+    outRecord.topAfter = _current->card;
+    outRecord.cardPosition = _current->cardPosition;
+    outRecord.stockCount = _current->stockCount;
+
+    _current = _current->parent;
     return true;
 }
 
+const UndoNode* UndoManager::getNextStepToward(const UndoNode* target) const {
+    if (!target || !_current || target->depth <= _current->depth) return nullptr;
+
+    const UndoNode* node = target;
+    while (node->depth > _current->depth + 1) node = node->parent;
+    return node->parent == _current ? node : nullptr;
+}
+
+bool UndoManager::isAncestorOf(const UndoNode* ancestor, const UndoNode* node) {
+    if (!ancestor) return false;
+    while (node && node->depth > ancestor->depth) node = node->parent;
+    return node == ancestor;
+}
+
+UndoNode* UndoManager::nextInPreorder(UndoNode* node) const {
+    if (node->firstChild) return node->firstChild;
+    while (node != _root) {
+        if (node->nextSibling) return node->nextSibling;
+        node = node->parent;
+    }
+    return nullptr;
+}
+
+const UndoNode* UndoManager::findNode(int id) const {
+    for (UndoNode* node = _root; node; node = nextInPreorder(node)) {
+        if (node->id == id) return node;
+    }
+    return nullptr;
+}
+
+void UndoManager::shiftPositions(const Vec2& delta) {
+    for (UndoNode* node = _root; node; node = nextInPreorder(node)) {
+        if (node->type == MT_PLAYFIELD_TO_STACK) {
+            node->cardPosition += delta;
+        }
+    }
+}
+
 void UndoManager::clear() {
-    for (const auto& step : _undoStack) {
-        CC_SAFE_RELEASE(step.movedCard);
-        CC_SAFE_RELEASE(step.previousTopCard);
+    if (!_root) return;
+    while (_root->firstChild) {
+        recycleSubtree(_root->firstChild);
     }
-    _undoStack.clear();
-}
\ No newline at end of file
+    _current = _root;
+}
@@ -3,79 +3,191 @@
 #define __UNDO_MANAGER_H__
 
 #include "cocos2d.h"
-#include "models/CardModel.h"
-#include <vector>
+#include "models/MoveRecord.h"
+#include "models/ModelArena.h"
 
 /**
- * @struct UndoStep
- * @brief ݽṹ
- * 
- * ¼һϷбҪϢڳ
+ * @struct UndoNode
+ * @brief ʷһڵ㣺һ棬ԼӸڵ㵽һ
+ *
+ * ֻһƶĿƺͳֶΣ GameModel
+ * ڵ֮ǰľȽڵ㹲Ŀڳ / ʱڵ
  */
-struct UndoStep {
-    CardModel* movedCard;           ///< ƶĿ
-    cocos2d::Vec2 originalPos;      ///< Ƶԭʼλ
-    CardModel* previousTopCard;     ///< ǰĳƶѶ
-    bool isFromStock;               ///< ǷԱƶѣtrue=ӱƳȡfalse=Ϸ
+struct UndoNode {
+    int id;                        ///< ţΨһڵΪ 0
+    int depth;                     ///< ࿪ֵĲ
+    MoveType type;                 ///< ﱾڵĲڵΪ MT_NONE
+    CardModel* card;               ///< ƶĿƣĵƣ
+    CardModel* topBefore;          ///< ǰĵ
+    cocos2d::Vec2 cardPosition;    ///< Ϸλã MT_PLAYFIELD_TO_STACK
+    int stockCount;                ///< ڵıڵΪ -1
+    UndoNode* parent;
+    UndoNode* firstChild;          ///< ӽڵǰ
+    UndoNode* nextSibling;
+
+    UndoNode()
+        : id(0)
+        , depth(0)
+        , type(MT_NONE)
+        , card(nullptr)
+        , topBefore(nullptr)
+        , stockCount(-1)
+        , parent(nullptr)
+        , firstChild(nullptr)
+        , nextSibling(nullptr) {}
 };
 
 /**
  * @class UndoManager
- * @brief 
- * 
+ * @brief ֧ʷ
+ *
  * ְ
- * - ¼ҵÿһʷ
- * - ṩܣָϷ״̬
- * - ջ
- * 
+ * - ҵÿһ¼Ϊʷеһڵ㣬һʱԭķ֧
+ * - ṩת·˻عͬȣĿ֧
+ * - ʷڵڣͳƽڵڴ
+ *
  * ʹó
  * Ϊ GameController ĳԱ GameController ͳ
- * ÿҲ pushStep ¼
- * ťʱ popStep ָ
- * 
+ * ÿ GameModel ύ pushRecord ¼еһʱƵнڵ㣩
+ * ťʱ stepBack ȡ¼ GameModel::undoMove ָ
+ *
  * ԭ
  * - ʵΪΪ Controller ĳԱ
  * -  Controller
  * - ֻݵĴ洢ͼҵ߼
+ * - ʼ GameModel ƶѳУ¼еָ벻Ҫ retain
+ * - ڵֻһı仯ÿڴ濪̶С޹أ
+ *   ڵӱ ModelArena 䣬ؿʱɾͷţķ֧
+ * - ޾ģʽ֧Ʋȣʷʱ
  */
 class UndoManager {
 public:
+    static const int kReservedNodesPerCard = 4;   ///< ؿڴ水ÿſԤĽڵߵķ֧
+
+    /**
+     * @brief һֵʷҪ ModelArena Ԥֽ
+     * @param cardCount ֿdepthLimit Ϊ 0 ʱʹã
+     * @param depthLimit  reset ͬ
+     * @return  GameModel::prepareLevel  extraBytes
+     * @details ʱһ·ϵĽڵ뿨ͬÿǰһƣ
+     *          Ϊߵķ֧ kReservedNodesPerCard ʱڵ㱻ã
+     *          Ϊ޼ϸڵͲüǰ½ڵ
+     */
+    static size_t getReservedBytes(int cardCount, int depthLimit);
+
     UndoManager();
     ~UndoManager();
 
     /**
-     * @brief ¼һ
-     * @param movedCard ƶĿ
-     * @param originalPos Ƶԭʼλã꣩
-     * @param prevTop ǰĳƶѶ
-     * @param fromStock ǷԱƶ
-     * @note ÷ retain  CardModel ָ
+     * @brief Ϊµһִֻ־ʷ
+     * @param arena ֵڴ򣨳ֱ´ reset 
+     * @param depthLimit ɳ0 ʾƣĽڵ㱻
+     * @param keepBranches һʱǷԭķ֧޾ģʽ false
+     */
+    void reset(ModelArena* arena, int depthLimit, bool keepBranches);
+
+    /**
+     * @brief ¼һǰڵƵӽڵ
+     * @param record GameModel ӿڷصı¼
+     * @details 뵱ǰڵеӽڵͬʱƵǸڵ㣬½
+     */
+    void pushRecord(const MoveRecord& record);
+
+    /**
+     * @brief ƽнڵеϷλã޾ģʽؾ
+     * @param delta λ
      */
-    void pushStep(CardModel* movedCard, const cocos2d::Vec2& originalPos, 
-                  CardModel* prevTop, bool fromStock);
+    void shiftPositions(const cocos2d::Vec2& delta);
 
     /**
-     * @brief һ
-     * @param outStep 洢ĳ
-     * @return ɹ trueջΪշ false
-     * @note Ҫ release outStep е CardModel ָ
+     * @brief ˻ظڵ
+     * @param outRecord ǰڵı¼ GameModel::undoMove
+     * @return ɹ trueڸڵ㷵 false
+     * @note ǰڵ㱣У֮ת
      */
-    bool popStep(UndoStep& outStep);
+    bool stepBack(MoveRecord& outRecord);
 
     /**
-     * @brief гʷ
-     * @details ͷм¼ CardModel 
+     * @brief ӵǰڵǰ target һ
+     * @return ǰڵ target ·ϵӽڵ㣻target ڵǰڵ֮ʱ nullptr
+     */
+    const UndoNode* getNextStepToward(const UndoNode* target) const;
+
+    /**
+     * @brief ancestor ǷΪ node 
+     */
+    static bool isAncestorOf(const UndoNode* ancestor, const UndoNode* node);
+
+    /**
+     * @brief Ųҽڵ㣨
+     * @return ڵ㣬ѱ򲻴ڷ nullptr
+     */
+    const UndoNode* findNode(int id) const;
+
+    /**
+     * @brief гʷֻڵ
      */
     void clear();
-    
+
     /**
      * @brief ǷпɳĲ
-     * @return ջΪշ true
+     * @return ǰڵǸڵʱ true
+     */
+    bool isEmpty() const { return _current == _root; }
+
+    /**
+     * @brief Ƿ֧ת֧
+     */
+    bool isBranching() const { return _keepBranches; }
+
+    const UndoNode* getRoot() const { return _root; }
+    const UndoNode* getCurrent() const { return _current; }
+
+    /**
+     * @brief еĽڵڵ㣩
+     */
+    int getNodeCount() const { return _allocatedCount - _recycledCount; }
+
+    /**
+     * @brief ΪڵֽеĽڵ㣩
      */
-    bool isEmpty() const { return _undoStack.empty(); }
+    size_t getNodeBytes() const { return (size_t)_allocatedCount * sizeof(UndoNode); }
 
 private:
-    std::vector<UndoStep> _undoStack;  ///< ջ
+    /**
+     * @brief һڵڴռõֽڵС max_align_t ȡǰһηµĶ䣩
+     */
+    static size_t getNodeStride();
+
+    /**
+     * @brief ȡһڵ㣺ȸÿ _arena 
+     */
+    UndoNode* createNode();
+
+    /**
+     * @brief  node кŻؿӸڵժ
+     */
+    void recycleSubtree(UndoNode* node);
+
+    /**
+     * @brief ʱѸڵƵǰ·ϵӽڵ㣬֧
+     */
+    void pruneRoot();
+
+    /**
+     * @brief һڵ㣬 nullptr
+     */
+    UndoNode* nextInPreorder(UndoNode* node) const;
+
+    ModelArena* _arena;       ///< ڵڵڴ
+    UndoNode* _root;          ///< ɻصľ
+    UndoNode* _current;       ///< ǰ
+    UndoNode* _freeNodes;     ///<  nextSibling ӣ
+    int _depthLimit;          ///< ɳ0 ʾ
+    bool _keepBranches;       ///< Ƿ֧
+    int _nextId;              ///< һڵĴ
+    int _allocatedCount;      ///<  _arena Ľڵ
+    int _recycledCount;       ///< еĽڵ
 };
 
-#endif
\ No newline at end of file
+#endif
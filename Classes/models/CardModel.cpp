@@ -2,16 +2,38 @@
 // ļ: Classes/models/CardModel.cpp
 // --------------------------------------------------------
 #include "CardModel.h"
+#include "ModelArena.h"
 
 USING_NS_CC;
 
+namespace {
+    /**
+     * @brief ÿ CardModel ǰķͷ¼Դڴnullptr ʾѣ
+     * @note 䣬֤ͷ֮ĶַҪ
+     */
+    struct alignas(std::max_align_t) AllocationHeader {
+        ModelArena* arena;
+    };
+
+    void* attachHeader(void* block, ModelArena* arena) {
+        AllocationHeader* header = static_cast<AllocationHeader*>(block);
+        header->arena = arena;
+        return header + 1;
+    }
+}
+
 CardModel::CardModel() 
     : _id(-1)
     , _suit(CST_NONE)
     , _face(CFT_NONE)
     , _isFaceUp(false)
     , _columnIndex(-1)
-    , _localZOrder(0) {
+    , _localZOrder(0)
+    , _coveredCards(_inlineCovered)
+    , _coveredCount(0)
+    , _coveredCapacity(kInlineCoverLinks)
+    , _blockerCount(0)
+    , _inPlayField(false) {
 }
 
 CardModel::~CardModel() {
@@ -28,6 +50,91 @@ CardModel* CardModel::create(int id, CardSuitType suit, CardFaceType face) {
     return nullptr;
 }
 
+CardModel* CardModel::createInArena(ModelArena* arena, int id, CardSuitType suit, CardFaceType face) {
+    CardModel* model = new (arena) CardModel();
+    if (model && model->init(id, suit, face)) {
+        return model;
+    }
+    CC_SAFE_DELETE(model);
+    return nullptr;
+}
+
+// ===================== 亯 =====================
+
+void* CardModel::operator new(size_t size) {
+    return attachHeader(::operator new(sizeof(AllocationHeader) + size), nullptr);
+}
+
+void* CardModel::operator new(size_t size, const std::nothrow_t&) noexcept {
+    void* block = ::operator new(sizeof(AllocationHeader) + size, std::nothrow);
+    return block ? attachHeader(block, nullptr) : nullptr;
+}
+
+void* CardModel::operator new(size_t size, ModelArena* arena) noexcept {
+    if (!arena) {
+        return CardModel::operator new(size, std::nothrow);
+    }
+
+    // ȸµڴ棬޾ģʽ¿ƲϷͶռõڴ汣ֲ
+    void* block = arena->allocateRecyclable(sizeof(AllocationHeader) + size, alignof(AllocationHeader));
+    if (!block) return nullptr;
+
+    // ƴڼڴͷ
+    arena->retain();
+    return attachHeader(block, arena);
+}
+
+void CardModel::operator delete(void* ptr) {
+    if (!ptr) return;
+
+    AllocationHeader* header = static_cast<AllocationHeader*>(ptr) - 1;
+    if (header->arena) {
+        // ڴ潻ڴĿһͷʱ黹
+        ModelArena* arena = header->arena;
+        arena->recycle(header, sizeof(AllocationHeader) + sizeof(CardModel));
+        arena->release();
+    }
+    else {
+        ::operator delete(header);
+    }
+}
+
+void CardModel::operator delete(void* ptr, const std::nothrow_t&) {
+    CardModel::operator delete(ptr);
+}
+
+void CardModel::operator delete(void* ptr, ModelArena*) {
+    CardModel::operator delete(ptr);
+}
+
+void CardModel::setCoveredCards(CardModel** cards, int count) {
+    if (!cards || count <= 0) {
+        _coveredCards = _inlineCovered;
+        _coveredCapacity = kInlineCoverLinks;
+        _coveredCount = 0;
+        return;
+    }
+
+    if (count <= kInlineCoverLinks) {
+        for (int i = 0; i < count; i++) {
+            _inlineCovered[i] = cards[i];
+        }
+        _coveredCards = _inlineCovered;
+        _coveredCapacity = kInlineCoverLinks;
+    }
+    else {
+        _coveredCards = cards;
+        _coveredCapacity = count;
+    }
+    _coveredCount = count;
+}
+
+bool CardModel::addCoveredCard(CardModel* card) {
+    if (_coveredCount >= _coveredCapacity) return false;
+    _coveredCards[_coveredCount++] = card;
+    return true;
+}
+
 bool CardModel::init(int id, CardSuitType suit, CardFaceType face) {
     _id = id;
     _suit = suit;
@@ -6,6 +6,9 @@
 
 #include "cocos2d.h"
 #include "configs/GameConstants.h"
+#include <new>
+
+class ModelArena;
 
 /**
  * @class CardModel
@@ -23,9 +26,14 @@
  * ԭ
  * - ģͣҵ߼
  * - ̳ cocos2d::Ref ڴ
+ * - ؿеĿƴ ModelArena 䣺üʱճڴ潻ڴĿ
+ *   һſƸãÿſƳڴһãڴڴͷ
+ * - ڵϵڵ˭棬ڵ߻Żһֻڵļ
  */
 class CardModel : public cocos2d::Ref {
 public:
+    static const int kInlineCoverLinks = 4;   ///< ڲֱӴŵıڵ
+
     /**
      * @brief ģ
      * @param id Ψһʶ
@@ -35,6 +43,24 @@ public:
      */
     static CardModel* create(int id, CardSuitType suit, CardFaceType face);
 
+    /**
+     * @brief ڴдģ
+     * @param arena ڴ򣬴 nullptr ʱӶѷ
+     * @param id Ψһʶ
+     * @param suit ɫ
+     * @param face 
+     * @return üΪ 1 ĿģͣԶͷųأ÷ƶѺ releaseʧܷ nullptr
+     */
+    static CardModel* createInArena(ModelArena* arena, int id, CardSuitType suit, CardFaceType face);
+
+    // רķ亯ÿǰһ¼Դڴͷdelete ʱݴ˾Ƿ黹ڴ
+    static void* operator new(size_t size);
+    static void* operator new(size_t size, const std::nothrow_t&) noexcept;
+    static void* operator new(size_t size, ModelArena* arena) noexcept;
+    static void operator delete(void* ptr);
+    static void operator delete(void* ptr, const std::nothrow_t&);
+    static void operator delete(void* ptr, ModelArena* arena);
+
     /**
      * @brief ȡID
      * @return Ψһʶ
@@ -113,6 +139,50 @@ public:
      */
     void setColumnIndex(int column) { _columnIndex = column; }
 
+    /**
+     * @brief ñڵĿ
+     * @param cards ڵ飨ɵ÷ ModelArena 䣬 GameModel Уﲻ retain
+     * @param count 鳤
+     * @note  kInlineCoverLinks ʱƵڲ֮Կ addCoveredCard ׷
+     */
+    void setCoveredCards(CardModel** cards, int count);
+
+    /**
+     * @brief ׷һűڵĿƣ޾ģʽϷʱʹã
+     * @return ڲ洢 false
+     */
+    bool addCoveredCard(CardModel* card);
+    bool canAddCoveredCard() const { return _coveredCount < _coveredCapacity; }
+
+    /**
+     * @brief ȡڵĿǷϷ
+     */
+    int getCoveredCount() const { return _coveredCount; }
+
+    /**
+     * @brief ȡ index űڵĿ
+     */
+    CardModel* getCoveredCard(int index) const { return _coveredCards[index]; }
+
+    /**
+     * @brief ϷڵƵĿΪ 0 ʾԷ
+     */
+    int getBlockerCount() const { return _blockerCount; }
+    void setBlockerCount(int count) { _blockerCount = count; }
+
+    /**
+     * @brief ڵƵһſ뿪 / صϷ
+     * @return ºڵ
+     */
+    int removeBlocker() { return --_blockerCount; }
+    int addBlocker() { return ++_blockerCount; }
+
+    /**
+     * @brief ƵǰǷϷ GameModel άƶԲң
+     */
+    bool isInPlayField() const { return _inPlayField; }
+    void setInPlayField(bool inPlayField) { _inPlayField = inPlayField; }
+
     // ==================== л֧֣Ԥ ====================
     
     /**
@@ -149,6 +219,12 @@ private:
     int _localZOrder;                 ///< Ⱦ㼶
     cocos2d::Size _contentSize;       ///< ݳߴ
     int _columnIndex;                 ///< ڵ⣩
+    CardModel** _coveredCards;        ///< ڵĿƣãָ _inlineCovered  ModelArena е飩
+    int _coveredCount;                ///< ڵ
+    int _coveredCapacity;             ///< _coveredCards 
+    int _blockerCount;                ///< Ϸڵ
+    bool _inPlayField;                ///< ǷϷ
+    CardModel* _inlineCovered[kInlineCoverLinks];
 };
 
 #endif // __CARD_MODEL_H__
\ No newline at end of file
@@ -2,16 +2,45 @@
 // ļ: Classes/models/GameModel.cpp
 // --------------------------------------------------------
 #include "GameModel.h"
-#include <cmath>
+#include "utils/Logger.h"
+#include "utils/TraceProfiler.h"
 
 USING_NS_CC;
 
-GameModel::GameModel() : _topStackCard(nullptr) {}
+namespace {
+    /**
+     * @brief ɳɨ裺ԹΪģʵMatchPolicy::matches ѭչ
+     *        ÿɨֻھһκָ
+     */
+    template <class Rule>
+    int scanPlayableCard(const Vector<CardModel*>& cards, const CardModel* top) {
+        int topFace = (int)top->getFace();
+        int topSuit = (int)top->getSuit();
+        for (auto card : cards) {
+            if (card->isFaceUp()
+                && MatchPolicy<Rule>::matches((int)card->getFace(), (int)card->getSuit(), topFace, topSuit)) {
+                return card->getId();
+            }
+        }
+        return -1;
+    }
+}
+
+GameModel::GameModel()
+    : _arena(nullptr)
+    , _eventBus(nullptr)
+    , _feeder(nullptr)
+    , _stackLimit(0)
+    , _matchRule(MRT_TRIPEAKS)
+    , _matcher(getMatchFunction(MRT_TRIPEAKS))
+    , _scanPlayable(&scanPlayableCard<TriPeaksRule>)
+    , _isGameOver(false) {}
 
 GameModel::~GameModel() {
-    CC_SAFE_RELEASE(_topStackCard);
     _playFieldCards.clear();
     _stockCards.clear();
+    _stackCards.clear();
+    CC_SAFE_RELEASE(_arena);
 }
 
 GameModel* GameModel::create() {
@@ -27,105 +56,246 @@ GameModel* GameModel::create() {
 bool GameModel::init() {
     _playFieldCards.clear();
     _stockCards.clear();
-    setTopStackCard(nullptr);
+    _stackCards.clear();
+    CC_SAFE_RELEASE_NULL(_arena);
+    _eventBus = nullptr;
+    _feeder = nullptr;
+    _stackLimit = 0;
+    setMatchRule(MRT_TRIPEAKS);
+    _isGameOver = false;
     return true;
 }
 
+void GameModel::setMatchRule(MatchRuleType rule) {
+    _matchRule = rule;
+    _matcher = getMatchFunction(rule);
+
+    // һΣfindPlayableCard / isGameLost ѭڲپָ
+    switch (rule) {
+        case MRT_GOLF:          _scanPlayable = &scanPlayableCard<GolfRule>; break;
+        case MRT_PYRAMID:       _scanPlayable = &scanPlayableCard<PyramidRule>; break;
+        case MRT_SUIT_SEQUENCE: _scanPlayable = &scanPlayableCard<SuitSequenceRule>; break;
+        default:                _scanPlayable = &scanPlayableCard<TriPeaksRule>; break;
+    }
+}
+
+void GameModel::prepareLevel(int playFieldCount, int stockCount, int coverLinks, size_t extraBytes) {
+    int cardCount = playFieldCount + stockCount;
+
+    // ÿſƣ + ͷ + ڵбϲΪһָ飬ÿϷһƫ
+    size_t blockSize = (size_t)cardCount * (sizeof(CardModel) + 2 * alignof(std::max_align_t))
+        + (size_t)coverLinks * sizeof(CardModel*) + (size_t)(playFieldCount + 1) * sizeof(int)
+        + 2 * alignof(std::max_align_t) + extraBytes;
+
+    CC_SAFE_RELEASE(_arena);
+    _arena = ModelArena::create(blockSize);
+    CC_SAFE_RETAIN(_arena);
+
+    _playFieldCards.reserve(playFieldCount);
+    _stockCards.reserve(stockCount);
+    _stackCards.reserve(cardCount);
+}
+
 // 
-void GameModel::addPlayFieldCard(CardModel* card) { if (card) _playFieldCards.pushBack(card); }
-void GameModel::removePlayFieldCard(CardModel* card) { if (card) _playFieldCards.eraseObject(card); }
-void GameModel::setTopStackCard(CardModel* card) {
-    if (_topStackCard != card) {
-        CC_SAFE_RELEASE(_topStackCard);
-        _topStackCard = card;
-        CC_SAFE_RETAIN(_topStackCard);
+void GameModel::addPlayFieldCard(CardModel* card) {
+    if (!card) return;
+    _playFieldCards.pushBack(card);
+    card->setInPlayField(true);
+}
+CardModel* GameModel::getPlayFieldCardById(int cardId) const {
+    for (auto card : _playFieldCards) {
+        if (card->getId() == cardId) return card;
     }
+    return nullptr;
+}
+CardModel* GameModel::getTopStackCard() const { return _stackCards.empty() ? nullptr : _stackCards.back(); }
+CardModel* GameModel::getStackCard(int depth) const {
+    int index = (int)_stackCards.size() - 1 - depth;
+    return (depth >= 0 && index >= 0) ? _stackCards.at(index) : nullptr;
 }
 void GameModel::addStockCard(CardModel* card) { if (card) _stockCards.pushBack(card); }
-CardModel* GameModel::drawStockCard() {
-    if (_stockCards.empty()) return nullptr;
+
+void GameModel::insertStockCardAtBottom(CardModel* card) {
+    if (!card) return;
+    card->setFaceUp(false);
+    _stockCards.insert(0, card);
+    publish(GET_STOCK_COUNT_CHANGED, -1, getStockCount());
+}
+
+bool GameModel::insertPlayFieldCard(CardModel* card, CardModel* const* coveringCards, int count) {
+    if (!card) return false;
+
+    // ȼ޸ģ֤ʧʱģͲ
+    for (int i = 0; i < count; i++) {
+        if (!coveringCards[i]->canAddCoveredCard()) return false;
+    }
+
+    int blockers = 0;
+    for (int i = 0; i < count; i++) {
+        coveringCards[i]->addCoveredCard(card);
+        if (coveringCards[i]->isInPlayField()) blockers++;
+    }
+    card->setBlockerCount(blockers);
+    card->setFaceUp(blockers == 0);
+    addPlayFieldCard(card);
+    publish(GET_CARD_ADDED, card->getId(), 0);
+    return true;
+}
+
+void GameModel::shiftCardPositions(const Vec2& delta) {
+    // Z  Y 3000 - yλͬ
+    int zDelta = -(int)delta.y;
+    for (auto card : _playFieldCards) {
+        card->setPosition(card->getPosition() + delta);
+        card->setLocalZOrder(card->getLocalZOrder() + zDelta);
+    }
+    for (auto card : _stackCards) {
+        card->setPosition(card->getPosition() + delta);
+        card->setLocalZOrder(card->getLocalZOrder() + zDelta);
+    }
+}
+
+void GameModel::pushStackCard(CardModel* card) {
+    _stackCards.pushBack(card);
+    if (_stackLimit > 0 && (int)_stackCards.size() > _stackLimit) {
+        // ޾ģʽȵĿƲٻصϷͷźڴ ModelArena 
+        _stackCards.erase(0);
+    }
+}
+
+// ===================== ӿ =====================
+
+MoveRecord GameModel::applyPlayFieldMove(CardModel* card) {
+    MoveRecord record;
+    if (!card || !card->isFaceUp() || !_playFieldCards.contains(card)) return record;
+    if (!canMatch(card, getTopStackCard())) return record;
+
+    record.type = MT_PLAYFIELD_TO_STACK;
+    record.card = card;
+    record.topBefore = getTopStackCard();
+    record.topAfter = card;
+    record.cardPosition = card->getPosition();
+
+    // ѹƶٴϷƳ֤ʼձĳƶѳ
+    pushStackCard(card);
+    _playFieldCards.eraseObject(card);
+    card->setInPlayField(false);
+    publish(GET_CARD_REMOVED, card->getId(), 0);
+    updateCoveredCards(card, false, &record);
+    publishTopChanged();
+
+    if (_feeder) {
+        _feeder->feed(this);
+    }
+
+    record.stockCount = getStockCount();
+    updateGameOver();
+    return record;
+}
+
+MoveRecord GameModel::applyStockDraw() {
+    MoveRecord record;
+    if (_stockCards.empty()) return record;
+
     CardModel* card = _stockCards.back();
-    card->retain();
-    _stockCards.eraseObject(card);
-    return card;
+    record.type = MT_STOCK_TO_STACK;
+    record.card = card;
+    record.topBefore = getTopStackCard();
+    record.topAfter = card;
+
+    pushStackCard(card);
+    _stockCards.popBack();
+    card->setFaceUp(true);
+    publishTopChanged();
+    publish(GET_STOCK_COUNT_CHANGED, -1, getStockCount());
+
+    record.stockCount = getStockCount();
+    updateGameOver();
+    return record;
+}
+
+MoveRecord GameModel::undoMove(const MoveRecord& record) {
+    MoveRecord inverse;
+    if (!record.isValid() || getTopStackCard() != record.card) return inverse;
+
+    inverse.type = record.type;
+    inverse.isUndo = true;
+    inverse.card = record.card;
+    inverse.topBefore = record.card;
+    inverse.topAfter = record.topBefore;
+    inverse.cardPosition = record.cardPosition;
+
+    CardModel* card = record.card;
+    if (record.type == MT_PLAYFIELD_TO_STACK) {
+        _playFieldCards.pushBack(card);
+        card->setInPlayField(true);
+        _stackCards.popBack();
+        card->setPosition(record.cardPosition);
+        updateCoveredCards(card, true, &inverse);
+    }
+    else {
+        _stockCards.pushBack(card);
+        _stackCards.popBack();
+        card->setFaceUp(false);
+        publish(GET_STOCK_COUNT_CHANGED, -1, getStockCount());
+    }
+    publishTopChanged();
+
+    inverse.stockCount = getStockCount();
+    return inverse;
 }
-void GameModel::returnToStock(CardModel* card) { if (card) _stockCards.pushBack(card); }
-int GameModel::getStockCount() const { return _stockCards.size(); }
 
 // ---------------------------------------------------------------------
-// 㷨ڵ
+// 㷨ƥڵ
 // ---------------------------------------------------------------------
 
 bool GameModel::canMatch(CardModel* cardA, CardModel* cardB) {
     if (!cardA || !cardB) return false;
-    int v1 = (int)cardA->getFace();
-    int v2 = (int)cardB->getFace();
-    if (std::abs(v1 - v2) == 1) return true;
-    if ((v1 == 1 && v2 == 13) || (v1 == 13 && v2 == 1)) return true;
-    return false;
+    return _matcher((int)cardA->getFace(), (int)cardA->getSuit(), (int)cardB->getFace(), (int)cardB->getSuit());
 }
 
-bool GameModel::isCardBlocked(CardModel* card, const cocos2d::Vec2& cardPos, 
-                               const std::map<CardModel*, cocos2d::Vec2>& allCardsPos) {
-    if (!card) return false;
-    
-    // ǰƵײΣʹ 70% ĳߴ磬ֻص
-    Size cardSize = card->getContentSize() * 0.7f;
-    Rect cardRect(
-        cardPos.x - cardSize.width / 2,
-        cardPos.y - cardSize.height / 2,
-        cardSize.width,
-        cardSize.height
-    );
-
-    // 
-    for (auto otherCard : _playFieldCards) {
-        if (otherCard == card) continue;
-
-        auto it = allCardsPos.find(otherCard);
-        if (it == allCardsPos.end()) continue;
-        
-        Vec2 otherPos = it->second;
-        
-        // ؼֻ Y С¡ʾϲ㣩Ʋڵǰ
-        // ͬһУY ͬӽƲụڵ
-        if (otherPos.y >= cardPos.y - 10.0f) continue;  // 10px ݲ
-        
-        Size otherSize = otherCard->getContentSize() * 0.7f;
-        Rect otherRect(
-            otherPos.x - otherSize.width / 2,
-            otherPos.y - otherSize.height / 2,
-            otherSize.width,
-            otherSize.height
-        );
-
-        // ཻ = ڵ
-        if (cardRect.intersectsRect(otherRect)) {
-            return true;
+int GameModel::findPlayableCard() {
+    CardModel* top = getTopStackCard();
+    return top ? _scanPlayable(_playFieldCards, top) : -1;
+}
+
+bool GameModel::isCardBlocked(CardModel* card) const {
+    return card && card->getBlockerCount() > 0;
+}
+
+void GameModel::updateCoveredCards(CardModel* card, bool entering, MoveRecord* record) {
+    CM_TRACE_SCOPE("GameModel::updateCoveredCards");
+
+    // ֻбڵĿ״̬ܱ仯С޹
+    for (int i = 0; i < card->getCoveredCount(); i++) {
+        CardModel* covered = card->getCoveredCard(i);
+        int blockers = entering ? covered->addBlocker() : covered->removeBlocker();
+        if (!covered->isInPlayField()) continue;
+
+        bool blocked = blockers > 0;
+        if (covered->isFaceUp() == blocked) {
+            if (record) record->addFlipped(covered);
+            publish(blocked ? GET_CARD_COVERED : GET_CARD_REVEALED, covered->getId(), 0);
+            covered->setFaceUp(!blocked);
         }
     }
-    return false;
 }
 
 // ===================== ĺˢп״̬ =====================
-void GameModel::refreshCardStates() {
+void GameModel::refreshCardStates(MoveRecord* record) {
+    CM_TRACE_SCOPE("GameModel::refreshCardStates");
     if (_playFieldCards.empty()) return;
 
-    // 1. ռпƵλ
-    std::map<CardModel*, Vec2> allCardsPos;
-    for (auto card : _playFieldCards) {
-        if (card) {
-            allCardsPos[card] = card->getPosition();
-        }
-    }
-
-    // 2. пƣڵ״̬ó
     for (auto card : _playFieldCards) {
         if (!card) continue;
         
-        bool blocked = isCardBlocked(card, card->getPosition(), allCardsPos);
+        bool blocked = isCardBlocked(card);
         
         // ڵ = 棨ɵδڵ = 棨ɵ
+        if (card->isFaceUp() == blocked) {
+            if (record) record->addFlipped(card);
+            publish(blocked ? GET_CARD_COVERED : GET_CARD_REVEALED, card->getId(), 0);
+        }
         card->setFaceUp(!blocked);
     }
 }
@@ -142,13 +312,59 @@ bool GameModel::isGameLost() {
     if (!topCard) return false;
 
     // Ƿзƥ
-    for (auto card : _playFieldCards) {
-        if (card && card->isFaceUp()) {
-            if (canMatch(card, topCard)) {
-                return false;
-            }
-        }
+    if (_scanPlayable(_playFieldCards, topCard) >= 0) {
+        return false;
     }
 
     return _stockCards.empty();
+}
+
+// ===================== ¼ =====================
+void GameModel::publish(GameEventType type, int cardId, int value) {
+    if (!_eventBus) return;
+
+    GameEvent event;
+    event.type = type;
+    event.cardId = cardId;
+    event.suit = CST_NONE;
+    event.face = CFT_NONE;
+    event.value = value;
+    for (int i = 0; i < GameEvent::kMaxBeneathCards; i++) {
+        event.beneathSuit[i] = CST_NONE;
+        event.beneathFace[i] = CFT_NONE;
+    }
+    if (!_eventBus->publish(event)) {
+        CM_LOG_WARN(LC_GAME, "GameEventBus full, event %d dropped", (int)type);
+    }
+}
+
+void GameModel::publishTopChanged() {
+    if (!_eventBus) return;
+
+    CardModel* top = getTopStackCard();
+    GameEvent event;
+    event.type = GET_TOP_CHANGED;
+    event.cardId = top ? top->getId() : -1;
+    event.suit = top ? (int)top->getSuit() : CST_NONE;
+    event.face = top ? (int)top->getFace() : CFT_NONE;
+    event.value = 0;
+    for (int i = 0; i < GameEvent::kMaxBeneathCards; i++) {
+        CardModel* beneath = getStackCard(i + 1);
+        event.beneathSuit[i] = beneath ? (int)beneath->getSuit() : CST_NONE;
+        event.beneathFace[i] = beneath ? (int)beneath->getFace() : CFT_NONE;
+        if (beneath) event.value = i + 1;
+    }
+    if (!_eventBus->publish(event)) {
+        CM_LOG_WARN(LC_GAME, "GameEventBus full, event %d dropped", (int)GET_TOP_CHANGED);
+    }
+}
+
+void GameModel::updateGameOver() {
+    if (_isGameOver) return;
+
+    bool won = isGameWon();
+    if (won || isGameLost()) {
+        _isGameOver = true;
+        publish(GET_GAME_OVER, -1, won ? 1 : 0);
+    }
 }
\ No newline at end of file
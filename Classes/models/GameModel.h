@@ -6,7 +6,11 @@
 
 #include "cocos2d.h"
 #include "CardModel.h"
-#include <map> // Ҫ map
+#include "ModelArena.h"
+#include "MoveRecord.h"
+#include "PlayFieldFeeder.h"
+#include "managers/GameEventBus.h"
+#include "configs/MatchRules.h"
 
 /**
  * @class GameModel
@@ -14,12 +18,16 @@
  * 
  * ְ
  * - ƶѡƶѵ
- * - ṩڵ㷨isCardBlocked
+ * - άÿƵڵ߻ŻһʱֻڵĿƣisCardBlocked
+ * - ޾ģʽ½ܲƷ¿ƣֻĵƶ
  * - жϷʤ
  * - ֧л/л浵ܣ
  * 
  * ʹó
  *  GameController ͳУп״̬ͨ
+ * 
+ * ӿڣapplyPlayFieldMove / applyStockDraw / undoMoveڵ÷ǰȫ޸ģ
+ * ģͲͣڶеİύ״̬¼ߺÿ޸ͬʱӦ GameEvent
  */
 class GameModel : public cocos2d::Ref {
 public:
@@ -38,12 +46,78 @@ public:
      */
     bool init();
     
+    /**
+     * @brief ¼
+     * @param eventBus ¼ߣУ nullptr ʾ¼
+     * @note ؿɺãɹе޸ͼȫȾ
+     */
+    void setEventBus(GameEventBus* eventBus) { _eventBus = eventBus; }
+
+    /**
+     * @brief ùؿƥ
+     * @param rule ƥһѡӦ MatchPolicy ʵ
+     */
+    void setMatchRule(MatchRuleType rule);
+    MatchRuleType getMatchRule() const { return _matchRule; }
+
+    /**
+     * @brief ؿģ׼ֵڴ
+     * @param playFieldCount Ϸ
+     * @param stockCount 
+     * @param coverLinks ڵбܳ
+     * @param extraBytes ÷Ҫӱڴֽ糷ʷ
+     * @details һȫơڵб extraBytes  ModelArenaԤƶ
+     *          ֮Ĺؿɲٴƶ
+     */
+    void prepareLevel(int playFieldCount, int stockCount, int coverLinks, size_t extraBytes = 0);
+
+    /**
+     * @brief ȡֵڴprepareLevel ֮ǰΪ nullptr
+     */
+    ModelArena* getArena() const { return _arena; }
+
+    /**
+     * @brief ϷƷ޾ģʽ
+     * @param feeder ƷУ nullptr ʾͨؿ
+     */
+    void setFeeder(PlayFieldFeeder* feeder) { _feeder = feeder; }
+
+    /**
+     * @brief ƵƶѱĿ
+     * @param limit ޣ0 ʾ
+     * @details ʱѹĿƣ費Сڳ + 1 + ʾĿ
+     *          ֤пɳ¼õĿȻ
+     */
+    void setStackLimit(int limit) { _stackLimit = limit; }
+
+    /**
+     * @brief Ϸһ¿ƣ޾ģʽƣ
+     * @param card ¿ƣλú Z 
+     * @param coveringCards ڵ¿ƵĿƣԿɳϷĵƶѿƣ
+     * @param count ڵ
+     * @return ڵƵڲ洢ʱ falseʱ
+     * @details ֻڵƵıڵб¿Ƶڵ¼
+     */
+    bool insertPlayFieldCard(CardModel* card, CardModel* const* coveringCards, int count);
+
+    /**
+     * @brief ڱƶѵײһƣ޾ģʽƣ
+     */
+    void insertStockCardAtBottom(CardModel* card);
+
+    /**
+     * @brief ƽϷ͵ƶѿƵλã޾ģʽؾ
+     * @param delta λ
+     */
+    void shiftCardPositions(const cocos2d::Vec2& delta);
+
     /**
      * @brief ˢпƵķ/״̬
-     * @details ݼڵ㷨ÿǷڵ
-     *          ڵΪ棬δڵƷ
+     * @details ڵȫó򣺱ڵΪ棬δڵƷ
+     *          ֻڹؿʱã֮Ĳӿ
+     * @param record ѡ¼仯Ŀ
      */
-    void refreshCardStates();
+    void refreshCardStates(MoveRecord* record = nullptr);
     
     /**
      * @brief ӿƵ
@@ -52,33 +126,63 @@ public:
     void addPlayFieldCard(CardModel* card);
     
     // ---  ---
-    cocos2d::Vector<CardModel*> getPlayFieldCards() const { return _playFieldCards; }
-    void removePlayFieldCard(CardModel* card);
+    const cocos2d::Vector<CardModel*>& getPlayFieldCards() const { return _playFieldCards; }
+    /**
+     * @brief  ID Ϸ
+     * @param cardId  ID
+     * @return ģͣϷ nullptr
+     */
+    CardModel* getPlayFieldCardById(int cardId) const;
 
     // --- ƶ ---
-    void setTopStackCard(CardModel* card);
-    CardModel* getTopStackCard() const { return _topStackCard; }
+    /**
+     * @brief ȡƶѶĿ
+     * @return ǰƣƶΪշ nullptr
+     */
+    CardModel* getTopStackCard() const;
+
+    /**
+     * @brief ȻȡƶеĿ
+     * @param depth 0 Ϊƣ1 ΪƵһţ
+     * @return ģͣƶȷ nullptr
+     */
+    CardModel* getStackCard(int depth) const;
 
     // --- ƶ ---
     void addStockCard(CardModel* card);
+    int getStockCount() const;
+
+    // --- ӿڣͬύر¼ ---
     /**
-     * @brief ӱƶѳȡһ
-     * @return ȡĿƣƶΪշ nullptr
-     * @note ÷Ҫֶ release()
+     * @brief ϷĿƵƶ
+     * @param card ҪƶĿƣ뷭ƥ䣩
+     * @return ¼ʱЧ¼ģͲ
+     * @details Ƴơѹƶѡ¼ڵһεȫ
      */
-    CardModel* drawStockCard();
-    void returnToStock(CardModel* card);
-    int getStockCount() const;
+    MoveRecord applyPlayFieldMove(CardModel* card);
+
+    /**
+     * @brief ӱƶѳһƵƶ
+     * @return ¼ƶΪʱЧ¼
+     */
+    MoveRecord applyStockDraw();
+
+    /**
+     * @brief һύĲ
+     * @param record applyPlayFieldMove / applyStockDraw صļ¼
+     * @return ¼isUndo Ϊ trueͼų
+     * @note 밴ύ
+     */
+    MoveRecord undoMove(const MoveRecord& record);
 
     // --- ġڵ ---
     /**
      * ĳǷڵ
      * @param card Ŀ
-     * @param cardPos ĿƵ
-     * @param allCardsPos Ƶӳ
      * @return true=ڵ(ɵ), false=(ɵ)
+     * @details ڵϵڹؿʱȷֻȡڵμ
      */
-    bool isCardBlocked(CardModel* card, const cocos2d::Vec2& cardPos, const std::map<CardModel*, cocos2d::Vec2>& allCardsPos);
+    bool isCardBlocked(CardModel* card) const;
 
     // ʤж
     /**
@@ -93,12 +197,67 @@ public:
      */
     bool isGameLost();
 
-private:
+    /**
+     * @brief ϷǷѾѷ GET_GAME_OVER
+     */
+    bool isGameOver() const { return _isGameOver; }
+
+    /**
+     * @brief жǷƥ䣨ǰؿƥ
+     */
     bool canMatch(CardModel* cardA, CardModel* cardB);
 
+    /**
+     * @brief һŷƥϷ
+     * @return  IDûз -1
+     */
+    int findPlayableCard();
+
+private:
+    /**
+     * @brief һ¼δ¼ʱԣ
+     */
+    void publish(GameEventType type, int cardId, int value);
+
+    /**
+     * @brief ǰ
+     */
+    void publishTopChanged();
+
+    /**
+     * @brief жʤ״νʱ GET_GAME_OVER
+     */
+    void updateGameOver();
+
+    /**
+     * @brief 뿪 / صϷ󣬸±ڵĿƵڵͳ
+     * @param card ƶĿ
+     * @param entering true ʾصϷ
+     * @param record ¼仯Ŀ
+     */
+    void updateCoveredCards(CardModel* card, bool entering, MoveRecord* record);
+
+    /**
+     * @brief ѹƶѣʱĿ
+     */
+    void pushStackCard(CardModel* card);
+
+    /**
+     * @brief ʵĿɳɨ躯صһŷ top ƥĿ IDûз -1
+     */
+    typedef int (*PlayableScanFunction)(const cocos2d::Vector<CardModel*>& cards, const CardModel* top);
+
+    ModelArena* _arena;                         ///< ֵڴ򣨳У
+    GameEventBus* _eventBus;                    ///< ¼ߣУ
+    PlayFieldFeeder* _feeder;                   ///< ϷƷУ޾ģʽ
+    int _stackLimit;                            ///< ƶѱĿޣ0 ʾ
+    MatchRuleType _matchRule;                   ///< ǰؿƥ
+    MatchFunction _matcher;                     ///< Ӧƥ亯ж
+    PlayableScanFunction _scanPlayable;         ///< ӦĿɳɨ裨ƥжѭչ
+    bool _isGameOver;                           ///< Ƿж
     cocos2d::Vector<CardModel*> _playFieldCards;
     cocos2d::Vector<CardModel*> _stockCards;
-    CardModel* _topStackCard;
+    cocos2d::Vector<CardModel*> _stackCards;    ///< ƶѣback() Ϊǰ
 };
 
 #endif
\ No newline at end of file
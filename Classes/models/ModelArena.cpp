@@ -0,0 +1,43 @@
+// --------------------------------------------------------
+// ļ: Classes/models/ModelArena.cpp
+// --------------------------------------------------------
+#include "ModelArena.h"
+
+ModelArena::ModelArena(size_t blockSize)
+    : _arena(blockSize)
+    , _recycleSize(0)
+    , _freeBlocks(nullptr)
+    , _recycledCount(0) {
+}
+
+ModelArena* ModelArena::create(size_t blockSize) {
+    ModelArena* arena = new (std::nothrow) ModelArena(blockSize);
+    if (arena) {
+        arena->autorelease();
+    }
+    return arena;
+}
+
+void* ModelArena::allocateRecyclable(size_t size, size_t alignment) {
+    if (_recycleSize == 0) {
+        _recycleSize = size;
+    }
+    if (size == _recycleSize && _freeBlocks) {
+        FreeBlock* block = _freeBlocks;
+        _freeBlocks = block->next;
+        _recycledCount--;
+        return block;
+    }
+    // 䣬صڴԭҪζܸ
+    return _arena.allocate(size < sizeof(FreeBlock) ? sizeof(FreeBlock) : size,
+                           alignment > alignof(std::max_align_t) ? alignment : alignof(std::max_align_t));
+}
+
+void ModelArena::recycle(void* block, size_t size) {
+    if (!block || size != _recycleSize) return;
+
+    FreeBlock* freeBlock = static_cast<FreeBlock*>(block);
+    freeBlock->next = _freeBlocks;
+    _freeBlocks = freeBlock;
+    _recycledCount++;
+}
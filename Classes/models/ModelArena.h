@@ -0,0 +1,83 @@
+// --------------------------------------------------------
+// ļ: Classes/models/ModelArena.h
+// --------------------------------------------------------
+#ifndef __MODEL_ARENA_H__
+#define __MODEL_ARENA_H__
+
+#include "cocos2d.h"
+#include "utils/MonotonicArena.h"
+
+/**
+ * @class ModelArena
+ * @brief һϷģڴ
+ *
+ * ְ
+ * - ΪһϷĿģ͡ڵбͳ¼ṩڴ
+ * - һʹͷʱһԹ黹ȫڴ
+ *
+ * ʹó
+ *  GameModel ڼعؿʱ CardModel Գһã
+ * ͼ GameModel ͷſҲǰȫ
+ *
+ * ԭ
+ * - ̳ cocos2d::RefĿƺģһ
+ * - ؿذԤСһһڴ飻Ƴߴڴͨոãֻ䲻
+ */
+class ModelArena : public cocos2d::Ref {
+public:
+    /**
+     * @brief ڴ
+     * @param blockSize ׸ڴСؿģԤ
+     * @return Զͷŵ ModelArena ָ룬ʧܷ nullptr
+     */
+    static ModelArena* create(size_t blockSize = MonotonicArena::kDefaultBlockSize);
+
+    /**
+     * @brief һڴ棬ʧܷ nullptr
+     */
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
+        return _arena.allocate(size, alignment);
+    }
+
+    /**
+     * @brief  count  T ֵʼ
+     */
+    template <class T>
+    T* allocateArray(size_t count) { return _arena.allocateArray<T>(count); }
+
+    /**
+     * @brief һɻյڴ棬ȸ recycle صͬߴڴ
+     * @param size ֽڴֻΪһֳߴά״εʱĳߴ磩
+     * @param alignment 룬벻 alignof(std::max_align_t)
+     */
+    void* allocateRecyclable(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * @brief  allocateRecyclable ڴ飬´ͬߴ临
+     * @param block ڴ
+     * @param size ʱֽ
+     */
+    void recycle(void* block, size_t size);
+
+    /**
+     * @brief еڴ
+     */
+    size_t getRecycledCount() const { return _recycledCount; }
+
+    size_t getUsedBytes() const { return _arena.getUsedBytes(); }
+    size_t getBlockCount() const { return _arena.getBlockCount(); }
+
+private:
+    explicit ModelArena(size_t blockSize);
+
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    MonotonicArena _arena;
+    size_t _recycleSize;         ///< ڴߴ磬0 ʾδȷ
+    FreeBlock* _freeBlocks;      ///< ڵѽصڴڲ
+    size_t _recycledCount;       ///< 
+};
+
+#endif // __MODEL_ARENA_H__
@@ -0,0 +1,75 @@
+// --------------------------------------------------------
+// ļ: Classes/models/MoveRecord.h
+// --------------------------------------------------------
+#ifndef __MOVE_RECORD_H__
+#define __MOVE_RECORD_H__
+
+#include "cocos2d.h"
+
+class CardModel;
+
+/**
+ * @enum MoveType
+ * @brief һ
+ */
+enum MoveType {
+    MT_NONE = -1,             ///< Чδύκ޸ģ
+    MT_PLAYFIELD_TO_STACK,    ///< ϷƵƶ
+    MT_STOCK_TO_STACK         ///< ƶѳƵƶ
+};
+
+/**
+ * @struct MoveRecord
+ * @brief һģύı¼
+ *
+ *  GameModel ӿύɺ󷵻أһıʲô
+ * ͼֻݼ¼Ŷˢʾٷ޸ģͣ
+ * UndoManager ѳֶαΪʷڵ㣬ʱԭɼ¼ GameModel::undoMove ִ
+ *
+ * ԭ
+ * -  POD ṹɺͱ涼ڴ
+ * - ָ GameModel ĸƶѳУ¼ü
+ */
+struct MoveRecord {
+    static const int kMaxFlippedCards = 32;  ///< ¼ķ濨
+
+    MoveType type;                           ///< 
+    bool isUndo;                             ///< true ʾǳ¼
+    CardModel* card;                         ///< ƶĿ
+    CardModel* topBefore;                    ///< ύǰĵ
+    CardModel* topAfter;                     ///< ύĵ
+    cocos2d::Vec2 cardPosition;              ///< Ϸλã MT_PLAYFIELD_TO_STACK
+    int stockCount;                          ///< ύʣ
+    int flippedCount;                        ///< Ŀ
+    bool flippedOverflow;                    ///< 濨ƳޣͼҪȫˢ
+    CardModel* flippedCards[kMaxFlippedCards];  ///< Ŀƣģ͵ǰֵΪ׼
+
+    MoveRecord()
+        : type(MT_NONE)
+        , isUndo(false)
+        , card(nullptr)
+        , topBefore(nullptr)
+        , topAfter(nullptr)
+        , stockCount(0)
+        , flippedCount(0)
+        , flippedOverflow(false) {}
+
+    /**
+     * @brief ǷύЧ޸
+     */
+    bool isValid() const { return type != MT_NONE; }
+
+    /**
+     * @brief ׷һŷĿ
+     */
+    void addFlipped(CardModel* flipped) {
+        if (flippedCount < kMaxFlippedCards) {
+            flippedCards[flippedCount++] = flipped;
+        }
+        else {
+            flippedOverflow = true;
+        }
+    }
+};
+
+#endif // __MOVE_RECORD_H__
@@ -0,0 +1,28 @@
+// --------------------------------------------------------
+// ļ: Classes/models/PlayFieldFeeder.h
+// --------------------------------------------------------
+#ifndef __PLAY_FIELD_FEEDER_H__
+#define __PLAY_FIELD_FEEDER_H__
+
+class GameModel;
+
+/**
+ * @class PlayFieldFeeder
+ * @brief Ϸƽӿ
+ *
+ * ʹó
+ * ޾ģʽ EndlessDealer ʵ֣GameModel ÿǰύжʤǰã
+ * Ʒͨ GameModel::insertPlayFieldCard Ϸ
+ */
+class PlayFieldFeeder {
+public:
+    virtual ~PlayFieldFeeder() {}
+
+    /**
+     * @brief Ϸ
+     * @param model ύһģ
+     */
+    virtual void feed(GameModel* model) = 0;
+};
+
+#endif // __PLAY_FIELD_FEEDER_H__
@@ -0,0 +1,173 @@
+#include "EndlessDealer.h"
+#include "configs/GameConstants.h"
+#include "services/OcclusionResolver.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+USING_NS_CC;
+
+// жΪ 0.7 Ƴߴ磨382 x 592һУ600͸һţ390Ŀƶཻ
+// ÿֻһڵڵ
+const float EndlessDealer::kRowSpacing = 300.0f;
+const float EndlessDealer::kColumnSpacing = 260.0f;
+const float EndlessDealer::kFirstRowY = 1000.0f;
+const float EndlessDealer::kRebaseY = 16384.0f;
+
+namespace {
+    const float kScreenCenterX = 540.0f;
+
+    CardConfigData makeSlot(float x, float y) {
+        CardConfigData data;
+        data.face = 0;
+        data.suit = 0;
+        data.x = x;
+        data.y = y;
+        return data;
+    }
+}
+
+EndlessDealer::EndlessDealer()
+    : _random(0)
+    , _nextCardId(0)
+    , _rowsDealt(0)
+    , _nextRowY(kFirstRowY) {
+}
+
+EndlessDealer::~EndlessDealer() {
+    _previousRow.clear();
+}
+
+int EndlessDealer::getStackLimit() {
+    return kUndoDepth + 1 + GameEvent::kMaxBeneathCards;
+}
+
+void EndlessDealer::start(GameModel* model, uint64_t seed, size_t extraBytes) {
+    if (!model) return;
+
+    _random.reseed(seed);
+    _nextCardId = 0;
+    _rowsDealt = 0;
+    _nextRowY = kFirstRowY;
+    _previousRow.clear();
+
+    // ڴϷԤ֮󷢳ĿƸñƵڴ
+    model->prepareLevel(kMaxLiveCards, kMaxStock, 0, extraBytes);
+    model->setFeeder(nullptr);
+
+    for (int row = 0; row < kLiveRows; row++) {
+        dealRow(model);
+    }
+    for (int i = 0; i < kInitialStock; i++) {
+        CardModel* card = createCard(model);
+        if (!card) continue;
+        model->addStockCard(card);
+        card->release();
+    }
+
+    // ַĵƲɳ֮ĲֻҲ
+    model->applyStockDraw();
+    model->setStackLimit(getStackLimit());
+    model->setFeeder(this);
+}
+
+void EndlessDealer::feed(GameModel* model) {
+    int liveCards = (int)model->getPlayFieldCards().size();
+    while (liveCards < kMaxLiveCards && (liveCards < kMinLiveCards || countLiveRows(model) < kLiveRows)) {
+        dealRow(model);
+        liveCards = (int)model->getPlayFieldCards().size();
+    }
+}
+
+void EndlessDealer::dealRow(GameModel* model) {
+    // שǽ֣4  3 Ž棬ÿֻһڵڵ
+    int cardsInRow = (_rowsDealt % 2 == 0) ? kMaxRowCards : kMaxRowCards - 1;
+    float startX = kScreenCenterX - (cardsInRow - 1) * kColumnSpacing / 2.0f;
+    float y = _nextRowY;
+
+    CardModel* row[kMaxRowCards];
+    int rowCount = 0;
+    for (int col = 0; col < cardsInRow; col++) {
+        CardModel* card = createCard(model);
+        if (!card) continue;
+
+        float x = startX + col * kColumnSpacing;
+        card->setPosition(Vec2(x, y));
+        card->setLocalZOrder((int)(3000 - y));
+        card->setContentSize(Size(kCardWidth, kCardHeight));
+
+        // ֻһжڵøԶڵС
+        // һе갴о㣬λãѶĿƲӰж
+        CardModel* covering[CardModel::kInlineCoverLinks];
+        int coveringCount = 0;
+        CardConfigData slot = makeSlot(x, y);
+        for (auto upper : _previousRow) {
+            if (coveringCount < CardModel::kInlineCoverLinks
+                && OcclusionResolver::covers(makeSlot(upper->getPosition().x, y - kRowSpacing), slot)) {
+                covering[coveringCount++] = upper;
+            }
+        }
+
+        if (model->insertPlayFieldCard(card, covering, coveringCount)) {
+            row[rowCount++] = card;
+        }
+        card->release();
+    }
+
+    // ϷУٷ룬Vector 
+    _previousRow.clear();
+    for (int i = 0; i < rowCount; i++) {
+        _previousRow.pushBack(row[i]);
+    }
+    _nextRowY += kRowSpacing;
+    _rowsDealt++;
+
+    // дƣڱƶѵײ
+    if (_rowsDealt > kLiveRows) {
+        for (int i = 0; i < kStockPerRow && model->getStockCount() < kMaxStock; i++) {
+            CardModel* card = createCard(model);
+            if (!card) break;
+            model->insertStockCardAtBottom(card);
+            card->release();
+        }
+    }
+}
+
+CardModel* EndlessDealer::createCard(GameModel* model) {
+    // ȡ 1-13 LevelMaterializer Ϳһ
+    int face = (int)_random.nextBelow(13) + 1;
+    int suit = (int)_random.nextBelow(4);
+    CardModel* card = CardModel::createInArena(model->getArena(), _nextCardId++, (CardSuitType)suit, (CardFaceType)face);
+    if (card) card->setFaceUp(false);
+    return card;
+}
+
+int EndlessDealer::countLiveRows(GameModel* model) const {
+    const auto& cards = model->getPlayFieldCards();
+    if (cards.empty()) return 0;
+
+    float minY = FLT_MAX;
+    float maxY = -FLT_MAX;
+    for (auto card : cards) {
+        minY = std::min(minY, card->getPosition().y);
+        maxY = std::max(maxY, card->getPosition().y);
+    }
+    return (int)std::floor((maxY - minY) / kRowSpacing + 0.5f) + 1;
+}
+
+Vec2 EndlessDealer::rebase(GameModel* model) {
+    const auto& cards = model->getPlayFieldCards();
+    float minY = _nextRowY;
+    for (auto card : cards) {
+        minY = std::min(minY, card->getPosition().y);
+    }
+
+    // оƣ걣Ϊȷֵؾǰڵж Z һ
+    int rows = (int)std::floor((minY - kFirstRowY) / kRowSpacing);
+    if (rows <= 0) return Vec2::ZERO;
+
+    Vec2 delta(0.0f, -rows * kRowSpacing);
+    model->shiftCardPositions(delta);
+    _nextRowY += delta.y;
+    return delta;
+}
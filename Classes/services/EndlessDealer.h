@@ -0,0 +1,105 @@
+#ifndef __ENDLESS_DEALER_H__
+#define __ENDLESS_DEALER_H__
+
+#include "cocos2d.h"
+#include "models/GameModel.h"
+#include "models/PlayFieldFeeder.h"
+#include "utils/SeededRandom.h"
+
+/**
+ * @class EndlessDealer
+ * @brief ޾ģʽķƷ
+ *
+ * ְ
+ * - ַשǽֵĿƺͱ
+ * - յһ̶ʱϷһе油У
+ * - ֵؾ֤ Z Ϸʱ
+ *
+ * ʹó
+ * û CARDMATCH_ENDLESS  GameController ͳУ
+ * Ϊ PlayFieldFeeder ҵ GameModel ϣÿǰύ󱻵
+ *
+ * ԭ
+ * - ֻܱһڵʱֻһڵж¼
+ * - ϷƶѳȺͳȶй̶ޣڴ͵ʱ
+ * -  SeededRandom ͬһӵõͬһ
+ */
+class EndlessDealer : public PlayFieldFeeder {
+public:
+    static const int kLiveRows = 5;          ///< 󱣳ֵ
+    static const int kMaxRowCards = 4;       ///< һĿһŵн棩
+    static const int kMinLiveCards = 12;     ///< Ϸڴʱ
+    static const int kMaxLiveCards = 28;     ///< Ϸﵽʱٲ
+    static const int kInitialStock = 16;     ///< ֱ
+    static const int kStockPerRow = 2;       ///< ÿһвı
+    static const int kMaxStock = 24;         ///< 
+    static const int kUndoDepth = 32;        ///< 
+    static const float kRowSpacing;          ///< о
+    static const float kColumnSpacing;       ///< ͬһڿƵļ
+    static const float kFirstRowY;           ///< һе Y 
+    static const float kRebaseY;             ///< 곬ֵʱؾ
+
+    EndlessDealer();
+    ~EndlessDealer();
+
+    /**
+     * @brief ڿģϿʼһ޾ģʽ
+     * @param model մϷģ
+     * @param seed 
+     * @param extraBytes ÷Ҫӱڴֽת GameModel::prepareLevel
+     * @details ֵкͱơһŵƣģ͵ĲƷ͵ƶ
+     */
+    void start(GameModel* model, uint64_t seed, size_t extraBytes = 0);
+
+    /**
+     * @brief 貹УPlayFieldFeeder
+     */
+    void feed(GameModel* model) override;
+
+    /**
+     * @brief ƶҪĿ + ǰ + ʾĿ
+     */
+    static int getStackLimit();
+
+    /**
+     * @brief Ƿѳؾֵ
+     */
+    bool needsRebase() const { return _nextRowY > kRebaseY; }
+
+    /**
+     * @brief ģеĿƣʹһлص kFirstRowY 
+     * @param model Ϸģ
+     * @return ʩӵλƣоࣩ÷ݴƽƳ¼ͼ
+     */
+    cocos2d::Vec2 rebase(GameModel* model);
+
+    /**
+     * @brief ۼƷ
+     */
+    int getRowsDealt() const { return _rowsDealt; }
+
+private:
+    /**
+     * @brief ڵǰһеϷһ
+     */
+    void dealRow(GameModel* model);
+
+    /**
+     * @brief һĿ
+     * @return üΪ 1 Ŀƣ÷ƶѺ release
+     */
+    CardModel* createCard(GameModel* model);
+
+    /**
+     * @brief ϷƵȹ㵱ǰ
+     */
+    int countLiveRows(GameModel* model) const;
+
+    SeededRandom _random;
+    int _nextCardId;                              ///< һſƵ IDϷͱƹã
+    int _rowsDealt;                               ///< ۼƷ
+    float _nextRowY;                              ///< һе Y 
+    cocos2d::Vector<CardModel*> _previousRow;     ///< һУãоݴжڵ
+};
+
+#endif
@@ -1,44 +1,105 @@
 #include "GameModelGenerator.h"
 #include "configs/GameConstants.h"
+#include "services/OcclusionResolver.h"
+#include "utils/Logger.h"
+#include <algorithm>
 
 USING_NS_CC;
 
-void GameModelGenerator::generate(GameModel* model, const LevelConfig& config) {
+void GameModelGenerator::generate(GameModel* model, const LevelConfig& config, size_t extraBytes) {
     if (!model) return;
 
+    // δؿ빤ߴľɰؿļʱһڵϵ
+    if (!config.occlusionResolved && !config.playfieldCards.empty()) {
+        CM_LOG_WARN(LC_GAME, "Level occlusion not baked, resolving at load time. Run tools/level_compiler on the level file.");
+        LevelConfig resolved = config;
+        OcclusionResolver::resolve(resolved);
+        generate(model, resolved, extraBytes);
+        return;
+    }
+
+    model->setMatchRule(config.matchRule);
+
+    // һֵĿơڵб͵÷ĳʷͬһڴ
+    int coverLinks = 0;
+    for (const auto& data : config.playfieldCards) {
+        coverLinks += (int)data.coveredBy.size();
+    }
+    model->prepareLevel((int)config.playfieldCards.size(), (int)config.stackCards.size(), coverLinks, extraBytes);
+    ModelArena* arena = model->getArena();
+
     // 1. ؿ
     int id = 0;
     for (const auto& data : config.playfieldCards) {
-        auto card = CardModel::create(id, (CardSuitType)data.suit, (CardFaceType)data.face);
+        auto card = CardModel::createInArena(arena, id, (CardSuitType)data.suit, (CardFaceType)data.face);
+        if (!card) continue;
         card->setPosition(Vec2(data.x, data.y));
         
         // ġZ-Order  Y 
         // Y ԽСԽ£Z Խߣʾϲ㣬ڵƣ
         card->setLocalZOrder((int)(3000 - data.y));
         
-        // ƴСײ⣩
-        card->setContentSize(Size(150 * 3.5f, 210 * 3.5f));  // 525 x 735
+        // ƴСͼһ£546 x 846
+        card->setContentSize(Size(kCardWidth, kCardHeight));
         
         // ʼΪ棬 refreshCardStates 
         card->setFaceUp(false);
         
         model->addPlayFieldCard(card);
+        card->release();
         id++;
     }
 
+    // ڵϵؿļе coveredBy˭ڵңתΪÿƵıڵбڵ˭
+    // ͬʱ¼ÿƵڵ֮߻ŻһֻڵĿ
+    const auto& playFieldCards = model->getPlayFieldCards();
+    int cardCount = std::min((int)config.playfieldCards.size(), (int)playFieldCards.size());
+    int* ends = arena ? arena->allocateArray<int>(cardCount + 1) : nullptr;
+    CardModel** links = arena ? arena->allocateArray<CardModel*>(coverLinks) : nullptr;
+    if (ends && links) {
+        // һ飺ÿڵĿۼΪб links е
+        std::fill(ends, ends + cardCount + 1, 0);
+        for (int i = 0; i < cardCount; i++) {
+            int blockers = 0;
+            for (int coverIndex : config.playfieldCards[i].coveredBy) {
+                if (coverIndex < 0 || coverIndex >= cardCount || coverIndex == i) continue;
+                ends[coverIndex + 1]++;
+                blockers++;
+            }
+            playFieldCards.at(i)->setBlockerCount(blockers);
+        }
+        for (int i = 1; i <= cardCount; i++) {
+            ends[i] += ends[i - 1];
+        }
+
+        // ڶ飺˳д룻д ends[i] ǵ i бյ㣬 i + 1 Ƶ
+        for (int i = 0; i < cardCount; i++) {
+            for (int coverIndex : config.playfieldCards[i].coveredBy) {
+                if (coverIndex < 0 || coverIndex >= cardCount || coverIndex == i) continue;
+                links[ends[coverIndex]++] = playFieldCards.at(i);
+            }
+        }
+
+        //  kInlineCoverLinks ʱƵڲֱָ links еһ
+        for (int i = 0; i < cardCount; i++) {
+            int begin = i > 0 ? ends[i - 1] : 0;
+            if (ends[i] > begin) {
+                playFieldCards.at(i)->setCoveredCards(links + begin, ends[i] - begin);
+            }
+        }
+    }
+
     // 2. ɱ
     for (const auto& data : config.stackCards) {
-        auto card = CardModel::create(1000 + id++, (CardSuitType)data.suit, (CardFaceType)data.face);
+        auto card = CardModel::createInArena(arena, 1000 + id++, (CardSuitType)data.suit, (CardFaceType)data.face);
+        if (!card) continue;
         card->setFaceUp(false);
         model->addStockCard(card);
+        card->release();
     }
 
     // 3. ʼƷ
-    if (model->getStockCount() > 0) {
-        CardModel* start = model->drawStockCard();
-        start->setFaceUp(true);
-        model->setTopStackCard(start);
-    }
+    model->applyStockDraw();
 
     // 4. ؼݼڵÿƳ
     model->refreshCardStates();
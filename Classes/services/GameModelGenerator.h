@@ -13,6 +13,7 @@
  * - Ϸơƶ
  * - ʼƶѵĵһ
  * - ÿƵλá㼶ߴ
+ * - ѹؿе coveredBy ±תΪ֮ڵ
  * 
  * ʹó
  *  GameController ãڳʼϷ
@@ -28,9 +29,10 @@ public:
      * @brief Ϸģ
      * @param model ҪϷģ
      * @param config ؿ
-     * @details пƶóʼ״̬ refreshCardStates ڵϵ
+     * @param extraBytes ÷Ҫӱڴֽת GameModel::prepareLevel
+     * @details пƶóʼ״̬ڵã refreshCardStates ³
      */
-    static void generate(GameModel* model, const LevelConfig& config);
+    static void generate(GameModel* model, const LevelConfig& config, size_t extraBytes = 0);
 };
 
 #endif
\ No newline at end of file
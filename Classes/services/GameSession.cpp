@@ -0,0 +1,195 @@
+#include "GameSession.h"
+#include "services/OcclusionResolver.h"
+
+const int GameSession::kScorePerCard;
+const int GameSession::kScorePerStockLeft;
+
+CompiledLevel CompiledLevel::compile(const LevelConfig& config) {
+    if (!config.occlusionResolved && !config.playfieldCards.empty()) {
+        LevelConfig resolved = config;
+        OcclusionResolver::resolve(resolved);
+        return compile(resolved);
+    }
+
+    CompiledLevel level;
+    level.playfieldCount = (int)config.playfieldCards.size();
+    level.stockCount = (int)config.stackCards.size();
+    level.matchRule = config.matchRule;
+    level.matcher = getMatchFunction(config.matchRule);
+
+    for (const auto& card : config.playfieldCards) {
+        level.faces.push_back(card.face);
+        level.suits.push_back(card.suit);
+        level.coverStart.push_back((int)level.coverList.size());
+        for (int coverIndex : card.coveredBy) {
+            if (coverIndex >= 0 && coverIndex < level.playfieldCount) {
+                level.coverList.push_back(coverIndex);
+            }
+        }
+    }
+    level.coverStart.push_back((int)level.coverList.size());
+
+    for (const auto& card : config.stackCards) {
+        level.faces.push_back(card.face);
+        level.suits.push_back(card.suit);
+    }
+    return level;
+}
+
+GameSession::GameSession()
+    : _level(nullptr)
+    , _inPlay(nullptr)
+    , _stack(nullptr)
+    , _history(nullptr)
+    , _stackSize(0)
+    , _historySize(0)
+    , _drawn(0)
+    , _remaining(0)
+    , _isGameOver(true) {
+}
+
+bool GameSession::start(const CompiledLevel* level, MonotonicArena& arena) {
+    _level = level;
+    _isGameOver = true;
+    if (!level) return false;
+
+    // ÿƶһΣǰĴҲᳬ
+    int total = level->playfieldCount + level->stockCount;
+    _inPlay = arena.allocateArray<uint8_t>(level->playfieldCount);
+    _stack = arena.allocateArray<int>(total);
+    _history = arena.allocateArray<int>(total);
+    if (!_inPlay || !_stack || !_history) return false;
+
+    for (int i = 0; i < level->playfieldCount; i++) {
+        _inPlay[i] = 1;
+    }
+    _stackSize = 0;
+    _historySize = 0;
+    _drawn = 0;
+    _remaining = level->playfieldCount;
+    _isGameOver = false;
+
+    //  GameModelGenerator һ£ַһűƣһܳ
+    if (level->stockCount > 0) {
+        _stack[_stackSize++] = level->playfieldCount + level->stockCount - 1;
+        _drawn = 1;
+    }
+    _isGameOver = isWon() || isLost();
+    return true;
+}
+
+bool GameSession::apply(int move) {
+    if (_isGameOver) return false;
+
+    bool applied = false;
+    if (move == SMC_DRAW) {
+        applied = drawStock();
+    }
+    else if (move == SMC_UNDO) {
+        // Ȼصδ״̬ж
+        return undo();
+    }
+    else {
+        applied = tapCard(move);
+    }
+
+    if (applied) {
+        _isGameOver = isWon() || isLost();
+    }
+    return applied;
+}
+
+bool GameSession::tapCard(int index) {
+    if (index < 0 || index >= _level->playfieldCount || !_inPlay[index]) return false;
+    if (isBlocked(index)) return false;
+
+    int top = getTop();
+    if (top < 0 || !_level->matcher(_level->faces[index], _level->suits[index], _level->faces[top], _level->suits[top])) {
+        return false;
+    }
+
+    _inPlay[index] = 0;
+    _remaining--;
+    _stack[_stackSize++] = index;
+    _history[_historySize++] = index;
+    return true;
+}
+
+bool GameSession::drawStock() {
+    if (_drawn >= _level->stockCount) return false;
+
+    // ƴбĩβ
+    _stack[_stackSize++] = _level->playfieldCount + _level->stockCount - 1 - _drawn;
+    _drawn++;
+    _history[_historySize++] = SMC_DRAW;
+    return true;
+}
+
+bool GameSession::undo() {
+    if (_historySize == 0) return false;
+
+    int move = _history[--_historySize];
+    _stackSize--;
+    if (move == SMC_DRAW) {
+        _drawn--;
+    }
+    else {
+        _inPlay[move] = 1;
+        _remaining++;
+    }
+    return true;
+}
+
+bool GameSession::isBlocked(int index) const {
+    for (int i = _level->coverStart[index]; i < _level->coverStart[index + 1]; i++) {
+        if (_inPlay[_level->coverList[i]]) return true;
+    }
+    return false;
+}
+
+bool GameSession::isLost() const {
+    //  GameModel::isGameLost һ£ûеʱи
+    int top = getTop();
+    if (_remaining == 0 || top < 0) return false;
+    if (_drawn < _level->stockCount) return false;
+
+    for (int i = 0; i < _level->playfieldCount; i++) {
+        if (_inPlay[i] && !isBlocked(i)
+            && _level->matcher(_level->faces[i], _level->suits[i], _level->faces[top], _level->suits[top])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int GameSession::getScore() const {
+    if (!_level) return 0;
+
+    int score = (_level->playfieldCount - _remaining) * kScorePerCard;
+    if (isWon()) {
+        score += (_level->stockCount - _drawn) * kScorePerStockLeft;
+    }
+    return score;
+}
+
+uint64_t GameSession::getStateHash() const {
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ULL;
+    auto mix = [&hash](uint32_t value) {
+        for (int i = 0; i < 4; i++) {
+            hash ^= (value >> (i * 8)) & 0xFF;
+            hash *= 1099511628211ULL;
+        }
+    };
+
+    if (!_level) return hash;
+    for (int i = 0; i < _level->playfieldCount; i++) {
+        mix(_inPlay[i]);
+    }
+    mix((uint32_t)_drawn);
+    mix((uint32_t)_stackSize);
+    for (int i = 0; i < _stackSize; i++) {
+        mix((uint32_t)_stack[i]);
+    }
+    return hash;
+}
@@ -0,0 +1,128 @@
+#ifndef __GAME_SESSION_H__
+#define __GAME_SESSION_H__
+
+#include "configs/LevelConfig.h"
+#include "utils/MonotonicArena.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct CompiledLevel
+ * @brief ԤֻؿݣỰ / ̹߳
+ */
+struct CompiledLevel {
+    int playfieldCount;
+    int stockCount;
+    MatchRuleType matchRule;
+    MatchFunction matcher;           ///< ѡһεƥ亯
+    std::vector<int> faces;          ///< ± [0, playfieldCount) ΪϷƣ֮Ϊ
+    std::vector<int> suits;
+    std::vector<int> coverStart;     ///< Ϸ i ڵ coverList еķΧ [coverStart[i], coverStart[i + 1])
+    std::vector<int> coverList;
+
+    CompiledLevel() : playfieldCount(0), stockCount(0), matchRule(MRT_TRIPEAKS), matcher(nullptr) {}
+
+    /**
+     * @brief ӹؿɣδڵϵʱڲ㣩
+     */
+    static CompiledLevel compile(const LevelConfig& config);
+};
+
+/**
+ * @enum SessionMoveCode
+ * @brief е룬Ǹʾ±Ϸƣ GameModelGenerator Ŀ ID һ£
+ */
+enum SessionMoveCode {
+    SMC_DRAW = -1,   ///< ƶ
+    SMC_UNDO = -2    ///< 
+};
+
+/**
+ * @class GameSession
+ * @brief ȾĵϷ
+ *
+ * ְ
+ * -  GameModel ĹִеơơжǷϷ
+ * - жʤ÷ֺվϣ
+ *
+ * ʹó
+ * ɷ˵У̣tools/validation_hostطύĲ
+ *
+ * ԭ
+ * -  GameModel һ£ڵȡ coveredByƥʹ MatchPolicyٽܲ
+ * -  cocos2dһֵȫ״̬ӵ÷ṩ MonotonicArena 䣬ûỰ new/delete
+ * - ֻ±꣬ƶ
+ */
+class GameSession {
+public:
+    static const int kScorePerCard = 100;        ///< ÿһϷƵĵ÷
+    static const int kScorePerStockLeft = 50;    ///< ʤʱÿδñƵĽ
+
+    GameSession();
+
+    /**
+     * @brief ʼһ
+     * @param level ؿݣ÷֤ڻỰڼЧ
+     * @param arena ״̬ڴԴǰɵ÷ reset
+     * @return ʧܷ false
+     */
+    bool start(const CompiledLevel* level, MonotonicArena& arena);
+
+    /**
+     * @brief ִһ
+     * @param move Ϸ±꣬ SMC_DRAW / SMC_UNDO
+     * @return Ϸִз trueǷı
+     */
+    bool apply(int move);
+
+    bool isGameOver() const { return _isGameOver; }
+    bool isWon() const { return _remaining == 0; }
+
+    /**
+     * @brief ǰ÷֣Ƶ÷ + ʤʱʣ౸ƽ
+     */
+    int getScore() const;
+
+    /**
+     * @brief ϣϷʣ࿨ơƶ˳ѳ
+     */
+    uint64_t getStateHash() const;
+
+    /**
+     * @brief ϷǷڳ
+     */
+    bool isInPlay(int index) const { return _inPlay[index] != 0; }
+
+    /**
+     * @brief ϷǷڳϵĿڵ
+     */
+    bool isBlocked(int index) const;
+
+    /**
+     * @brief ǰƵĿ±꣨CompiledLevel е±꣩ûеƷ -1
+     */
+    int getTop() const { return _stackSize > 0 ? _stack[_stackSize - 1] : -1; }
+
+    /**
+     * @brief ѳıַһţ
+     */
+    int getDrawnCount() const { return _drawn; }
+
+private:
+    bool tapCard(int index);
+    bool drawStock();
+    bool undo();
+    bool isLost() const;
+
+    const CompiledLevel* _level;
+    uint8_t* _inPlay;       ///< ϷǷڳ
+    int* _stack;            ///< ƶѣCompiledLevel еĿ±꣩ĩβΪǰ
+    int* _history;          ///< ִеĲ± SMC_DRAWڳ
+    int _stackSize;
+    int _historySize;
+    int _drawn;             ///< ѳı
+    int _remaining;         ///< Ϸʣ࿨
+    bool _isGameOver;
+};
+
+#endif
@@ -2,6 +2,7 @@
 #define __LEVEL_GENERATOR_H__
 
 #include "configs/LevelConfig.h"
+#include <cstdint>
 
 /**
  * @class LevelGenerator
@@ -9,11 +10,10 @@
  * 
  * ְ
  * - ĬϵĽ
- * - ɱƶ
- * - ṩԹؿĿ
+ * - ɹؿؿÿս
  * 
  * ʹó
- * ļʱ GameController ĬϹؿ
+ * ļڣͨ CARDMATCH_SEED ָʱ GameController 
  * 
  * ԭ
  * - Services㣺ṩ̬
@@ -21,33 +21,21 @@
  */
 class LevelGenerator {
 public:
+    static const uint64_t kDefaultSerial = 4;   ///< ĬϹؿķţȷϿɽ⣩
+
     /**
      * @brief ĬϵĽ
      * @return ؿö
+     * @details  LevelMaterializer ̶ӷƣÿõͬһؿ
      */
     static LevelConfig generateDefaultPyramid();
-    
-private:
-    /**
-     * @brief ɽϷ
-     * @param config ö
-     */
-    static void generatePyramidCards(LevelConfig& config);
-    
-    /**
-     * @brief ɱƶ
-     * @param config ö
-     * @param count 
-     */
-    static void generateStockCards(LevelConfig& config, int count);
-    
+
     /**
-     * @brief 
-     * @param x X
-     * @param y Y
-     * @return 
+     * @brief ɹؿ
+     * @param seed ؿӣʽ LevelMaterializer
+     * @return ؿö޷ʶʱؿ
      */
-    static CardConfigData createRandomCard(float x, float y);
+    static LevelConfig generateFromSeed(uint64_t seed);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,198 @@
+#include "LevelMaterializer.h"
+#include "configs/GameConstants.h"
+#include "services/OcclusionResolver.h"
+#include "utils/SeededRandom.h"
+#include <cstdio>
+#include <cstring>
+
+const uint64_t LevelMaterializer::kSerialMask = (1ULL << LevelMaterializer::kLayoutShift) - 1;
+
+namespace {
+    const int kDeckSize = 52;
+    const uint64_t kDailySalt = 0x6361726464617921ULL;
+
+    CardConfigData makeSlot(float x, float y) {
+        CardConfigData data;
+        data.face = 0;
+        data.suit = 0;
+        data.x = x;
+        data.y = y;
+        return data;
+    }
+
+    /**
+     * @brief ԭ LevelGenerator ĬϹؿͬ 5 в
+     */
+    void buildPyramid(LevelConfig& config) {
+        const float kScreenCenterX = 540.0f;
+        const float kStartY = 1750.0f;
+        const int kPyramidRows = 5;
+        // ԭĬϹؿļࣨ 450 x 630 ľɿƳߴȡ 0.35 ߡ0.55 濨Ƴߴ仯
+        const float kRowVerticalSpacing = 220.5f;
+        const float kCardHorizontalSpacing = 247.5f;
+
+        for (int row = 0; row < kPyramidRows; row++) {
+            int cardsInRow = row + 1;
+            float startX = kScreenCenterX - (cardsInRow - 1) * kCardHorizontalSpacing / 2.0f;
+            float y = kStartY - row * kRowVerticalSpacing;
+            for (int col = 0; col < cardsInRow; col++) {
+                config.playfieldCards.push_back(makeSlot(startX + col * kCardHorizontalSpacing, y));
+            }
+        }
+    }
+
+    /**
+     * @brief ˫ݣlevel1.json мӳ 4 
+     */
+    void buildTwinStairs(LevelConfig& config) {
+        //  590ƵˮƽΪ 590 - 50kжȣ382.2 7 أ
+        // ڵλöӰ
+        for (int side = 0; side < 2; side++) {
+            for (int step = 0; step < 4; step++) {
+                float x = side == 0 ? 245.0f + step * 50.0f : 835.0f - step * 50.0f;
+                config.playfieldCards.push_back(makeSlot(x, 1200.0f - step * 200.0f));
+            }
+        }
+    }
+
+    /**
+     * @brief 壺3 ŷ嶥6 ɽ7 ɽ
+     */
+    void buildTriPeaks(LevelConfig& config) {
+        const float kPeakX[] = { 200.0f, 540.0f, 880.0f };
+        for (float x : kPeakX) {
+            config.playfieldCards.push_back(makeSlot(x, 1750.0f));
+        }
+        for (float x : kPeakX) {
+            config.playfieldCards.push_back(makeSlot(x - 90.0f, 1530.0f));
+            config.playfieldCards.push_back(makeSlot(x + 90.0f, 1530.0f));
+        }
+        for (int i = 0; i < 7; i++) {
+            config.playfieldCards.push_back(makeSlot(120.0f + i * 140.0f, 1310.0f));
+        }
+    }
+
+    struct LayoutTemplate {
+        const char* name;
+        void (*build)(LevelConfig& config);
+        int stockCount;
+        MatchRuleType matchRule;
+    };
+
+    const LayoutTemplate kLayouts[LLT_NUM_LAYOUTS] = {
+        { "Pyramid",    &buildPyramid,    24, MRT_TRIPEAKS },
+        { "TwinStairs", &buildTwinStairs, 16, MRT_TRIPEAKS },
+        { "TriPeaks",   &buildTriPeaks,   20, MRT_TRIPEAKS },
+    };
+
+    /**
+     * @brief תΪ 1970-01-01 㣬ʱ <ctime>
+     */
+    int64_t daysFromCivil(int year, int month, int day) {
+        year -= month <= 2 ? 1 : 0;
+        int64_t era = (year >= 0 ? year : year - 399) / 400;
+        int64_t yearOfEra = year - era * 400;
+        int64_t dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+        int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+        return era * 146097 + dayOfEra - 719468;
+    }
+}
+
+uint64_t LevelMaterializer::makeSeed(LevelLayoutType layout, uint64_t serial) {
+    return ((uint64_t)layout << kLayoutShift) | (serial & kSerialMask);
+}
+
+LevelLayoutType LevelMaterializer::getLayout(uint64_t seed) {
+    uint64_t layout = seed >> kLayoutShift;
+    return layout < (uint64_t)LLT_NUM_LAYOUTS ? (LevelLayoutType)layout : LLT_NUM_LAYOUTS;
+}
+
+const LevelConfig& LevelMaterializer::getTemplate(LevelLayoutType layout) {
+    // ھ̬ĳʼ̰߳ȫģ߳̿ͬʱԭؿ
+    static const struct Templates {
+        LevelConfig configs[LLT_NUM_LAYOUTS];
+        Templates() {
+            for (int i = 0; i < LLT_NUM_LAYOUTS; i++) {
+                kLayouts[i].build(configs[i]);
+                configs[i].stackCards.resize(kLayouts[i].stockCount, makeSlot(0.0f, 0.0f));
+                configs[i].matchRule = kLayouts[i].matchRule;
+                OcclusionResolver::resolve(configs[i]);
+            }
+        }
+    } templates;
+    return templates.configs[layout];
+}
+
+bool LevelMaterializer::materialize(uint64_t seed, LevelConfig& outConfig) {
+    LevelLayoutType layout = getLayout(seed);
+    if (layout == LLT_NUM_LAYOUTS) return false;
+
+    outConfig = getTemplate(layout);
+    int playfieldCount = (int)outConfig.playfieldCards.size();
+    int cardCount = playfieldCount + (int)outConfig.stackCards.size();
+
+    //  Fisher-Yates ϴƣֻҪȷǰ cardCount λ
+    int deck[kDeckSize];
+    for (int i = 0; i < kDeckSize; i++) deck[i] = i;
+
+    SeededRandom random(seed);
+    for (int i = 0; i < cardCount && i < kDeckSize; i++) {
+        int j = i + (int)random.nextBelow((uint32_t)(kDeckSize - i));
+        int card = deck[j];
+        deck[j] = deck[i];
+        deck[i] = card;
+
+        CardConfigData& data = i < playfieldCount ? outConfig.playfieldCards[i]
+                                                  : outConfig.stackCards[i - playfieldCount];
+        data.face = card % 13 + 1;
+        data.suit = card / 13;
+    }
+    return true;
+}
+
+uint64_t LevelMaterializer::getDailyCandidate(int year, int month, int day, int attempt) {
+    int64_t dayNumber = daysFromCivil(year, month, day);
+    uint64_t state = kDailySalt ^ ((uint64_t)dayNumber << 16) ^ (uint64_t)(uint32_t)attempt;
+    uint64_t serial = SeededRandom::splitMix64(state);
+
+    int64_t layout = dayNumber % LLT_NUM_LAYOUTS;
+    if (layout < 0) layout += LLT_NUM_LAYOUTS;
+    return makeSeed((LevelLayoutType)layout, serial);
+}
+
+std::string LevelMaterializer::formatSeed(uint64_t seed) {
+    char buffer[17];
+    snprintf(buffer, sizeof(buffer), "%016llx", (unsigned long long)seed);
+    return buffer;
+}
+
+bool LevelMaterializer::parseSeed(const std::string& text, uint64_t& outSeed) {
+    size_t start = (text.size() > 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X')) ? 2 : 0;
+    if (text.size() == start || text.size() - start > 16) return false;
+
+    uint64_t value = 0;
+    for (size_t i = start; i < text.size(); i++) {
+        char c = text[i];
+        int digit = (c >= '0' && c <= '9') ? c - '0'
+            : (c >= 'a' && c <= 'f') ? c - 'a' + 10
+            : (c >= 'A' && c <= 'F') ? c - 'A' + 10 : -1;
+        if (digit < 0) return false;
+        value = (value << 4) | (uint64_t)digit;
+    }
+    outSeed = value;
+    return true;
+}
+
+const char* LevelMaterializer::getLayoutName(LevelLayoutType layout) {
+    return layout >= 0 && layout < LLT_NUM_LAYOUTS ? kLayouts[layout].name : "Unknown";
+}
+
+bool LevelMaterializer::parseLayoutName(const char* name, LevelLayoutType& outLayout) {
+    for (int i = 0; i < LLT_NUM_LAYOUTS; i++) {
+        if (name && strcmp(name, kLayouts[i].name) == 0) {
+            outLayout = (LevelLayoutType)i;
+            return true;
+        }
+    }
+    return false;
+}
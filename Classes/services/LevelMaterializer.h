@@ -0,0 +1,92 @@
+#ifndef __LEVEL_MATERIALIZER_H__
+#define __LEVEL_MATERIALIZER_H__
+
+#include "configs/LevelConfig.h"
+#include <cstdint>
+#include <string>
+
+/**
+ * @enum LevelLayoutType
+ * @brief ؿģ壨Ϸλáƥ
+ */
+enum LevelLayoutType {
+    LLT_PYRAMID = 0,      ///< 5 н15 Ϸ + 24 ű
+    LLT_TWIN_STAIRS,      ///< нݣ8 Ϸ + 16 ű
+    LLT_TRIPEAKS,         ///< ɽ壬16 Ϸ + 20 ű
+    LLT_NUM_LAYOUTS
+};
+
+/**
+ * @class LevelMaterializer
+ * @brief  64 λؽؿ
+ *
+ * ְ
+ * - Ӹʽ 8 λǲģ壬 56 λǷ
+ * - ù̶αSeededRandomһ 52 зƣ벼ģ
+ * - ṩÿսĺѡ
+ *
+ * ʹó
+ * ؿֻӺõԪݣtools/level_pack ɣ
+ * ʱӻԭ LevelConfigÿսֻ跢һ
+ *
+ * ԭ
+ * - Services㣺ṩ̬
+ * - ֻ㣬ģ궼 0.5 ͬһƽ̨ϵõλͬĹؿ
+ * - ģڵϵֻһΣ֮ÿλԭֻģ岢
+ */
+class LevelMaterializer {
+public:
+    static const int kLayoutShift = 56;                 ///< ģеλ
+    static const uint64_t kSerialMask;                  ///< ռõĵ 56 λ
+
+    /**
+     * @brief 
+     * @param layout ģ
+     * @param serial ţֻȡ 56 λ
+     */
+    static uint64_t makeSeed(LevelLayoutType layout, uint64_t serial);
+
+    /**
+     * @brief ȡеĲģ
+     * @return ģ壻еģ޷ʶʱ LLT_NUM_LAYOUTS
+     */
+    static LevelLayoutType getLayout(uint64_t seed);
+
+    /**
+     * @brief ӻԭؿ
+     * @param seed ؿ
+     * @param outConfig ĹؿãڵϵѼ㣩
+     * @return еĲģ޷ʶʱ false
+     */
+    static bool materialize(uint64_t seed, LevelConfig& outConfig);
+
+    /**
+     * @brief ÿսĺѡ
+     * @param year 
+     * @param month £1-12
+     * @param day գ1-31
+     * @param attempt ѡţ 0 ʼ⣬һɽ
+     * @details ģ尴ֻͬһĺѡƽ̨һ
+     */
+    static uint64_t getDailyCandidate(int year, int month, int day, int attempt);
+
+    /**
+     * @brief  16 λʮַתؿед
+     */
+    static std::string formatSeed(uint64_t seed);
+    static bool parseSeed(const std::string& text, uint64_t& outSeed);
+
+    /**
+     * @brief ģöٻת"Pyramid" / "TwinStairs" / "TriPeaks"
+     */
+    static const char* getLayoutName(LevelLayoutType layout);
+    static bool parseLayoutName(const char* name, LevelLayoutType& outLayout);
+
+private:
+    /**
+     * @brief ȡģ壨Ϸλáڵϵͱͻɫδ
+     */
+    static const LevelConfig& getTemplate(LevelLayoutType layout);
+};
+
+#endif
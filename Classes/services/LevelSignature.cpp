@@ -0,0 +1,74 @@
+#include "LevelSignature.h"
+#include "services/OcclusionResolver.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+    const uint64_t kFnvOffset = 14695981039346656037ULL;
+    const uint64_t kFnvPrime = 1099511628211ULL;
+
+    /**
+     * @brief FNV-1aһ 4 ֽڻϣ
+     */
+    void mix(uint64_t& hash, int value) {
+        uint32_t bits = (uint32_t)value;
+        for (int i = 0; i < 4; i++) {
+            hash ^= (bits >> (i * 8)) & 0xFF;
+            hash *= kFnvPrime;
+        }
+    }
+}
+
+uint64_t LevelSignature::compute(const LevelConfig& config, bool includeSuits) {
+    if (!config.occlusionResolved && !config.playfieldCards.empty()) {
+        LevelConfig resolved = config;
+        OcclusionResolver::resolve(resolved);
+        return compute(resolved, includeSuits);
+    }
+
+    // ͬɫ»ɫӰ淨ȥ
+    includeSuits = includeSuits || isSuitSensitive(config.matchRule);
+
+    uint64_t hash = kFnvOffset;
+    mix(hash, (int)config.matchRule);
+
+    // Ϸ + ڵṹ
+    mix(hash, (int)config.playfieldCards.size());
+    for (const auto& card : config.playfieldCards) {
+        mix(hash, card.face);
+        if (includeSuits) mix(hash, card.suit);
+
+        std::vector<int> covers = card.coveredBy;
+        std::sort(covers.begin(), covers.end());
+        mix(hash, (int)covers.size());
+        for (int coverIndex : covers) {
+            mix(hash, coverIndex);
+        }
+    }
+
+    // ƶѣֻе˳
+    mix(hash, (int)config.stackCards.size());
+    for (const auto& card : config.stackCards) {
+        mix(hash, card.face);
+        if (includeSuits) mix(hash, card.suit);
+    }
+    return hash;
+}
+
+std::string LevelSignature::toHex(uint64_t signature) {
+    char buffer[17];
+    snprintf(buffer, sizeof(buffer), "%016llx", (unsigned long long)signature);
+    return buffer;
+}
+
+bool LevelSignature::fromHex(const std::string& text, uint64_t& outSignature) {
+    if (text.empty() || text.size() > 16) return false;
+
+    char* end = nullptr;
+    unsigned long long value = strtoull(text.c_str(), &end, 16);
+    if (!end || *end != '\0') return false;
+
+    outSignature = (uint64_t)value;
+    return true;
+}
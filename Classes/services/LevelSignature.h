@@ -0,0 +1,48 @@
+#ifndef __LEVEL_SIGNATURE_H__
+#define __LEVEL_SIGNATURE_H__
+
+#include "configs/LevelConfig.h"
+#include <cstdint>
+#include <string>
+
+/**
+ * @class LevelSignature
+ * @brief ؿĹ淶ǩ
+ * 
+ * ְ
+ * - ѹؿӳΪֻƥ򡢵ڵṹйء뻨ɫ޹ص 64 λǩ
+ * - ɫ޹صĹ£ֻлɫͬؿ淨ȫͬǩҲͬ
+ * 
+ * ʹó
+ * ɹؿȥعߣtools/level_dedupãܾѷؿȼ۵¹ؿ
+ * 
+ * ԭ
+ * - Services㣺ṩ̬
+ * - ǩڵϵ꣬΢ڵĹؿΪȼ
+ */
+class LevelSignature {
+public:
+    /**
+     * @brief ؿǩ
+     * @param config ؿãδڵϵʱڲ㣩
+     * @param includeSuits true ʱɫҲǩͳȥǰĹؿͬɫǰɫ
+     * @return 64 λǩ
+     * @note Ƶ˳ǩֻؿᱻʶΪȼ
+     */
+    static uint64_t compute(const LevelConfig& config, bool includeSuits = false);
+
+    /**
+     * @brief ǩתΪ 16 λʮַ
+     */
+    static std::string toHex(uint64_t signature);
+
+    /**
+     * @brief ʮַǩ
+     * @param text ʮַ
+     * @param outSignature 
+     * @return ʽ󷵻 false
+     */
+    static bool fromHex(const std::string& text, uint64_t& outSignature);
+};
+
+#endif
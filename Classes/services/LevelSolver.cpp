@@ -0,0 +1,147 @@
+#include "LevelSolver.h"
+#include "services/OcclusionResolver.h"
+#include <cstdint>
+#include <unordered_set>
+
+const int LevelSolver::kMaxPlayfieldCards;
+const int LevelSolver::kDrawMove;
+
+namespace {
+    /**
+     * @brief ûе״̬
+     */
+    struct SolverState {
+        uint64_t remaining;  ///< ϷĿƣ i λӦ playfieldCards[i]
+        int drawn;           ///< Ѵӱƶѳ
+        int top;             ///< ƣȥɫʱΪΪ  * 4 + ɫ
+
+        bool operator==(const SolverState& other) const {
+            return remaining == other.remaining && drawn == other.drawn && top == other.top;
+        }
+    };
+
+    struct SolverStateHash {
+        size_t operator()(const SolverState& state) const {
+            uint64_t hash = state.remaining * 0x9E3779B97F4A7C15ULL;
+            hash ^= ((uint64_t)state.drawn << 8) ^ (uint64_t)state.top;
+            hash *= 0xBF58476D1CE4E5B9ULL;
+            return (size_t)(hash ^ (hash >> 31));
+        }
+    };
+
+    /**
+     * @brief ʵ̣ѭеƥжȫ
+     */
+    template <class Rule>
+    class Search {
+    public:
+        Search(const LevelConfig& config, const SolverOptions& options, SolverResult& result)
+            : _config(config)
+            , _options(options)
+            , _result(result)
+            , _suitSymmetry(options.suitSymmetry && !Rule::kSameSuit)
+            , _coverMasks(config.playfieldCards.size(), 0) {
+            for (size_t i = 0; i < config.playfieldCards.size(); i++) {
+                for (int coverIndex : config.playfieldCards[i].coveredBy) {
+                    if (coverIndex >= 0 && coverIndex < (int)config.playfieldCards.size()) {
+                        _coverMasks[i] |= 1ULL << coverIndex;
+                    }
+                }
+            }
+        }
+
+        bool run(uint64_t remaining, int drawn, int topFace, int topSuit) {
+            if (remaining == 0) return true;
+            if (_result.statesVisited >= _options.maxStates) {
+                _result.exhausted = true;
+                return false;
+            }
+
+            SolverState state;
+            state.remaining = remaining;
+            state.drawn = drawn;
+            state.top = _suitSymmetry ? topFace : topFace * 4 + topSuit;
+            if (!_visited.insert(state).second) {
+                _result.tableHits++;
+                return false;
+            }
+            _result.statesVisited++;
+
+            // 1. ϷδڵƥĿ
+            const auto& cards = _config.playfieldCards;
+            for (size_t i = 0; i < cards.size(); i++) {
+                uint64_t bit = 1ULL << i;
+                if (!(remaining & bit) || (remaining & _coverMasks[i])) continue;
+                if (!MatchPolicy<Rule>::matches(cards[i].face, cards[i].suit, topFace, topSuit)) continue;
+
+                _result.solution.push_back((int)i);
+                if (run(remaining & ~bit, drawn, cards[i].face, cards[i].suit)) return true;
+                _result.solution.pop_back();
+                if (_result.exhausted) return false;
+            }
+
+            // 2. ӱƶѳƣ GameModel һ£бĩβ
+            const auto& stock = _config.stackCards;
+            if (drawn < (int)stock.size()) {
+                const CardConfigData& next = stock[stock.size() - 1 - drawn];
+                _result.solution.push_back(LevelSolver::kDrawMove);
+                if (run(remaining, drawn + 1, next.face, next.suit)) return true;
+                _result.solution.pop_back();
+            }
+            return false;
+        }
+
+    private:
+        const LevelConfig& _config;
+        const SolverOptions& _options;
+        SolverResult& _result;
+        bool _suitSymmetry;                  ///< ͬɫ»ɫӰ߷ܺϲ
+        std::vector<uint64_t> _coverMasks;   ///< ÿƵڵ
+        std::unordered_set<SolverState, SolverStateHash> _visited;
+    };
+}
+
+SolverResult LevelSolver::solve(const LevelConfig& config, const SolverOptions& options) {
+    SolverResult result;
+    if (config.playfieldCards.size() > (size_t)kMaxPlayfieldCards) {
+        result.supported = false;
+        return result;
+    }
+
+    if (!config.occlusionResolved && !config.playfieldCards.empty()) {
+        LevelConfig resolved = config;
+        OcclusionResolver::resolve(resolved);
+        return solve(resolved, options);
+    }
+
+    uint64_t remaining = config.playfieldCards.size() == 64
+        ? ~0ULL : (1ULL << config.playfieldCards.size()) - 1;
+
+    // ֻһΣ֮ڶӦģʵн
+    switch (config.matchRule) {
+        case MRT_GOLF:          return solveWith<GolfRule>(config, options, remaining);
+        case MRT_PYRAMID:       return solveWith<PyramidRule>(config, options, remaining);
+        case MRT_SUIT_SEQUENCE: return solveWith<SuitSequenceRule>(config, options, remaining);
+        default:                return solveWith<TriPeaksRule>(config, options, remaining);
+    }
+}
+
+template <class Rule>
+SolverResult LevelSolver::solveWith(const LevelConfig& config, const SolverOptions& options, uint64_t remaining) {
+    SolverResult result;
+
+    //  GameModelGenerator һ£ȴӱƶѷһΪƣûеʱ 0 κƶƥ
+    int drawn = 0;
+    int topFace = 0;
+    int topSuit = 0;
+    if (!config.stackCards.empty()) {
+        const CardConfigData& first = config.stackCards.back();
+        drawn = 1;
+        topFace = first.face;
+        topSuit = first.suit;
+    }
+
+    Search<Rule> search(config, options, result);
+    result.solvable = search.run(remaining, drawn, topFace, topSuit);
+    return result;
+}
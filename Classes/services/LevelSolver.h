@@ -0,0 +1,75 @@
+#ifndef __LEVEL_SOLVER_H__
+#define __LEVEL_SOLVER_H__
+
+#include "configs/LevelConfig.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct SolverOptions
+ * @brief 
+ */
+struct SolverOptions {
+    bool suitSymmetry;   ///< trueû淶ȥɫ״̬ȥأfalseƵľȥأͬɫǰ
+    size_t maxStates;    ///< չ״̬
+
+    SolverOptions() : suitSymmetry(true), maxStates(2000000) {}
+};
+
+/**
+ * @struct SolverResult
+ * @brief ͳ
+ */
+struct SolverResult {
+    bool supported;              ///< ؿģǷַ֧Χ
+    bool solvable;               ///< ǷҵϷ߷
+    bool exhausted;              ///< Ƿﵽ maxStates ֹʱ solvable ţ
+    size_t statesVisited;        ///< չ״̬
+    size_t tableHits;            ///< û״̬
+    std::vector<int> solution;   ///< ⷨϷ±꣬ LevelSolver::kDrawMove ʾ
+
+    SolverResult() : supported(true), solvable(false), exhausted(false), statesVisited(0), tableHits(0) {}
+};
+
+/**
+ * @class LevelSolver
+ * @brief ؿ
+ * 
+ * ְ
+ * - ԹؿжܷϷһⷨ
+ * - û¼չ״̬ظ
+ * 
+ * ʹó
+ * ߹ߵã¹ؿǷɽⲢͳ״̬ռģ
+ * 
+ * ԭ
+ * - Services㣺ṩ̬
+ * - ״ֻ̬ʣϷơѳ͵Ƶɫ޹صĹ£
+ *   ƵĻɫ״ֻ̬лɫͬ״̬ûкϲΪһ
+ * - ƥMatchRules.hڷһΣѭʵû麯
+ * - ڵϵȡ coveredBy бʱ GameModel һ
+ */
+class LevelSolver {
+public:
+    static const int kMaxPlayfieldCards = 64;   ///< Ϸ״̬ 64 λʾ
+    static const int kDrawMove = -1;            ///< ⷨбʾӱƶѳһš
+
+    /**
+     * @brief ؿ
+     * @param config ؿãδڵϵʱڲ㣩
+     * @param options 
+     * @return 
+     */
+    static SolverResult solve(const LevelConfig& config, const SolverOptions& options = SolverOptions());
+
+private:
+    /**
+     * @brief ԹΪģʵ
+     * @param remaining ʼϷ
+     */
+    template <class Rule>
+    static SolverResult solveWith(const LevelConfig& config, const SolverOptions& options, uint64_t remaining);
+};
+
+#endif
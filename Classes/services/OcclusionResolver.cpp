@@ -0,0 +1,71 @@
+#include "OcclusionResolver.h"
+#include "configs/GameConstants.h"
+#include <cmath>
+
+const float OcclusionResolver::kHitScale = 0.7f;
+const float OcclusionResolver::kRowTolerance = 10.0f;
+
+namespace {
+    /**
+     * @brief λжڵ
+     * @param dx ϲ㿨²㿨Ƶ X λ
+     * @param dy ϲ㿨²㿨Ƶ Y λ
+     */
+    bool coversAt(float dx, float dy) {
+        // ֻ Y С¡ʾϲ㣩Ʋڵ
+        if (dy >= -OcclusionResolver::kRowTolerance) return false;
+
+        // Ƴߴͬжཻ߽Ӵȼľ벻һжߴ
+        return std::fabs(dx) <= kCardWidth * OcclusionResolver::kHitScale
+            && std::fabs(dy) <= kCardHeight * OcclusionResolver::kHitScale;
+    }
+}
+
+bool OcclusionResolver::covers(const CardConfigData& upper, const CardConfigData& lower) {
+    return coversAt(upper.x - lower.x, upper.y - lower.y);
+}
+
+void OcclusionResolver::resolve(LevelConfig& config) {
+    auto& cards = config.playfieldCards;
+    for (size_t i = 0; i < cards.size(); i++) {
+        cards[i].coveredBy.clear();
+        for (size_t j = 0; j < cards.size(); j++) {
+            if (i != j && covers(cards[j], cards[i])) {
+                cards[i].coveredBy.push_back((int)j);
+            }
+        }
+    }
+    config.occlusionResolved = true;
+}
+
+std::vector<OcclusionConflict> OcclusionResolver::findJitterConflicts(const LevelConfig& config, float jitter) {
+    std::vector<OcclusionConflict> conflicts;
+    const auto& cards = config.playfieldCards;
+
+    // Ƹƫ jitterλ仯 2 * jitterж߽ģļֵ
+    const float offsets[] = { -2.0f * jitter, 0.0f, 2.0f * jitter };
+    for (size_t i = 0; i < cards.size(); i++) {
+        for (size_t j = 0; j < cards.size(); j++) {
+            if (i == j) continue;
+
+            float dx = cards[i].x - cards[j].x;
+            float dy = cards[i].y - cards[j].y;
+            bool original = coversAt(dx, dy);
+            bool stable = true;
+            for (float ox : offsets) {
+                for (float oy : offsets) {
+                    if (coversAt(dx + ox, dy + oy) != original) stable = false;
+                }
+            }
+
+            if (!stable) {
+                OcclusionConflict conflict;
+                conflict.upper = (int)i;
+                conflict.lower = (int)j;
+                conflict.covers = original;
+                conflicts.push_back(conflict);
+            }
+        }
+    }
+    return conflicts;
+}
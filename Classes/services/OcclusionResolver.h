@@ -0,0 +1,61 @@
+#ifndef __OCCLUSION_RESOLVER_H__
+#define __OCCLUSION_RESOLVER_H__
+
+#include "configs/LevelConfig.h"
+#include <vector>
+
+/**
+ * @struct OcclusionConflict
+ * @brief λö½ȶһԿ
+ */
+struct OcclusionConflict {
+    int upper;   ///< ϲ㿨±
+    int lower;   ///< ²㿨±
+    bool covers; ///< ԭʼλ upper Ƿڵ lower
+};
+
+/**
+ * @class OcclusionResolver
+ * @brief ؿڵϵ
+ * 
+ * ְ
+ * - ϷÿƵ coveredBy б
+ * - ڵϵСλöǷȶ
+ * 
+ * ʹó
+ * ɹؿ빤ߣtools/level_compilerߵãѽдؿļ
+ * ʱûԤĹؿɵĹؿɰؿļ
+ * 
+ * ԭ
+ * - Services㣺ṩ̬
+ * - ڵֻﶨ壬ʱ GameModel ֻȡ coveredBy б
+ */
+class OcclusionResolver {
+public:
+    static const float kHitScale;       ///< ڵжľռƳߴı
+    static const float kRowTolerance;   ///< Y ֵĿΪͬһУڵ
+
+    /**
+     * @brief жһǷڵһ
+     * @param upper λϲĿ
+     * @param lower ܱڵĿ
+     * @return Y Сʾϲ㣩жཻʱ true
+     */
+    static bool covers(const CardConfigData& upper, const CardConfigData& lower);
+
+    /**
+     * @brief ϷƵ coveredBy б
+     * @param config ؿãд playfieldCards[i].coveredBy
+     */
+    static void resolve(LevelConfig& config);
+
+    /**
+     * @brief ڵϵλö»ıĿƶ
+     * @param config ؿ
+     * @param jitter ÿ X/Y ϵƫ
+     * @return ȶĿƶбΪձʾȶ
+     */
+    static std::vector<OcclusionConflict> findJitterConflicts(const LevelConfig& config, float jitter);
+};
+
+#endif
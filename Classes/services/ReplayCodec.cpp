@@ -0,0 +1,198 @@
+#include "ReplayCodec.h"
+#include "services/GameSession.h"
+#include <algorithm>
+
+static_assert(SMC_DRAW == -1 && SMC_UNDO == -2, "ReplayReader move codes must match SessionMoveCode");
+
+namespace {
+    void putVarint(std::vector<uint8_t>& out, uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back((uint8_t)(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back((uint8_t)value);
+    }
+
+    void putLittleEndian(std::vector<uint8_t>& out, uint64_t value, int bytes) {
+        for (int i = 0; i < bytes; i++) {
+            out.push_back((uint8_t)(value >> (8 * i)));
+        }
+    }
+
+    uint64_t getLittleEndian(const uint8_t* data, int bytes) {
+        uint64_t value = 0;
+        for (int i = 0; i < bytes; i++) {
+            value |= (uint64_t)data[i] << (8 * i);
+        }
+        return value;
+    }
+
+    uint64_t zigzag(int value) {
+        return (uint64_t)(((uint32_t)value << 1) ^ (uint32_t)(value >> 31));
+    }
+
+    /**
+     * @brief λ interval2 * interval ...  0 һ
+     */
+    uint32_t indexCountFor(uint32_t moveCount, uint16_t interval) {
+        return moveCount > 0 ? (moveCount - 1) / interval : 0;
+    }
+}
+
+// ---------------------------------------------------------------------
+// ReplayWriter
+// ---------------------------------------------------------------------
+
+ReplayWriter::ReplayWriter()
+    : _lastTimeMs(0)
+    , _previousCard(0) {
+    begin(0, 0, MRT_TRIPEAKS);
+}
+
+void ReplayWriter::begin(uint64_t levelHash, uint64_t seed, MatchRuleType matchRule, uint16_t indexInterval) {
+    _header = ReplayHeader();
+    _header.version = kFormatVersion;
+    _header.matchRule = matchRule;
+    _header.levelHash = levelHash;
+    _header.seed = seed;
+    _header.indexInterval = indexInterval > 0 ? indexInterval : 1;
+    _stream.clear();
+    _index.clear();
+    _lastTimeMs = 0;
+    _previousCard = 0;
+}
+
+void ReplayWriter::reserve(size_t moves) {
+    // ÿͨ 2-3 ֽڣԤ 4 ֽ
+    _stream.reserve(moves * 4);
+    _index.reserve((moves / _header.indexInterval + 1) * kIndexEntryBytes);
+}
+
+void ReplayWriter::addMove(int move, uint32_t timeMs) {
+    uint32_t moveIndex = _header.moveCount;
+    if (moveIndex > 0 && moveIndex % _header.indexInterval == 0) {
+        // ¼һ֮ǰ״̬
+        putLittleEndian(_index, _stream.size(), 4);
+        putLittleEndian(_index, _lastTimeMs, 4);
+        putLittleEndian(_index, (uint32_t)_previousCard, 4);
+    }
+
+    uint64_t token;
+    if (move >= 0) {
+        token = (zigzag(move - _previousCard) << 2) | RT_CARD;
+        _previousCard = move;
+    }
+    else {
+        token = move == SMC_DRAW ? RT_DRAW : RT_UNDO;
+    }
+    if (timeMs < _lastTimeMs) timeMs = _lastTimeMs;
+
+    putVarint(_stream, token);
+    putVarint(_stream, timeMs - _lastTimeMs);
+    _lastTimeMs = timeMs;
+    _header.moveCount++;
+}
+
+void ReplayWriter::finish(std::vector<uint8_t>& out) const {
+    out.reserve(out.size() + kHeaderBytes + _stream.size() + _index.size());
+
+    putLittleEndian(out, kMagic, 4);
+    putLittleEndian(out, _header.version, 2);
+    putLittleEndian(out, (uint8_t)_header.matchRule, 1);
+    putLittleEndian(out, 0, 1);
+    putLittleEndian(out, _header.levelHash, 8);
+    putLittleEndian(out, _header.seed, 8);
+    putLittleEndian(out, _header.moveCount, 4);
+    putLittleEndian(out, _stream.size(), 4);
+    putLittleEndian(out, _header.indexInterval, 2);
+    putLittleEndian(out, 0, 2);
+
+    out.insert(out.end(), _stream.begin(), _stream.end());
+    out.insert(out.end(), _index.begin(), _index.end());
+}
+
+// ---------------------------------------------------------------------
+// ReplayReader
+// ---------------------------------------------------------------------
+
+ReplayReader::ReplayReader()
+    : _stream(nullptr)
+    , _cursor(nullptr)
+    , _end(nullptr)
+    , _index(nullptr)
+    , _indexCount(0)
+    , _moveIndex(0)
+    , _timeMs(0)
+    , _previousCard(0) {
+}
+
+bool ReplayReader::open(const uint8_t* data, size_t size) {
+    _header = ReplayHeader();
+    _stream = _cursor = _end = _index = nullptr;
+    _indexCount = 0;
+    _moveIndex = 0;
+    _timeMs = 0;
+    _previousCard = 0;
+
+    if (!data || size < ReplayWriter::kHeaderBytes) return false;
+    if (getLittleEndian(data, 4) != ReplayWriter::kMagic) return false;
+
+    ReplayHeader header;
+    header.version = (uint16_t)getLittleEndian(data + 4, 2);
+    uint8_t matchRule = data[6];
+    header.levelHash = getLittleEndian(data + 8, 8);
+    header.seed = getLittleEndian(data + 16, 8);
+    header.moveCount = (uint32_t)getLittleEndian(data + 24, 4);
+    header.streamBytes = (uint32_t)getLittleEndian(data + 28, 4);
+    header.indexInterval = (uint16_t)getLittleEndian(data + 32, 2);
+    if (header.version == 0 || header.version > ReplayWriter::kFormatVersion) return false;
+    if (matchRule >= MRT_NUM_RULES || header.indexInterval == 0) return false;
+    header.matchRule = (MatchRuleType)matchRule;
+
+    // ÿ 2 ֽ
+    if ((uint64_t)header.moveCount * 2 > header.streamBytes) return false;
+    uint32_t indexCount = indexCountFor(header.moveCount, header.indexInterval);
+    uint64_t total = ReplayWriter::kHeaderBytes + (uint64_t)header.streamBytes
+        + (uint64_t)indexCount * ReplayWriter::kIndexEntryBytes;
+    if (total > size) return false;
+
+    _header = header;
+    _stream = _cursor = data + ReplayWriter::kHeaderBytes;
+    _end = _stream + header.streamBytes;
+    _index = _end;
+    _indexCount = indexCount;
+    return true;
+}
+
+size_t ReplayReader::getEncodedSize() const {
+    if (!_stream) return 0;
+    return ReplayWriter::kHeaderBytes + _header.streamBytes + (size_t)_indexCount * ReplayWriter::kIndexEntryBytes;
+}
+
+bool ReplayReader::seek(uint32_t moveIndex) {
+    if (!_stream || moveIndex > _header.moveCount) return false;
+
+    // ӲĿһͷ뵽Ŀ
+    uint32_t entry = std::min(moveIndex / _header.indexInterval, _indexCount);
+    if (entry == 0) {
+        _cursor = _stream;
+        _moveIndex = 0;
+        _timeMs = 0;
+        _previousCard = 0;
+    }
+    else {
+        const uint8_t* record = _index + (size_t)(entry - 1) * ReplayWriter::kIndexEntryBytes;
+        uint32_t offset = (uint32_t)getLittleEndian(record, 4);
+        if (offset > _header.streamBytes) return false;
+        _cursor = _stream + offset;
+        _moveIndex = entry * _header.indexInterval;
+        _timeMs = (uint32_t)getLittleEndian(record + 4, 4);
+        _previousCard = (int)(uint32_t)getLittleEndian(record + 8, 4);
+    }
+
+    ReplayMove skipped;
+    while (_moveIndex < moveIndex) {
+        if (!next(skipped)) return false;
+    }
+    return true;
+}
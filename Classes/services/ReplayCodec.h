@@ -0,0 +1,214 @@
+#ifndef __REPLAY_CODEC_H__
+#define __REPLAY_CODEC_H__
+
+#include "configs/MatchRules.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @enum ReplayToken
+ * @brief ǵĵ 2 λ
+ */
+enum ReplayToken {
+    RT_CARD = 0,   ///< ƣλΪһεĿ±֮zigzag 룩
+    RT_DRAW = 1,   ///< 
+    RT_UNDO = 2    ///< 
+};
+
+/**
+ * @struct ReplayHeader
+ * @brief طļͷ
+ */
+struct ReplayHeader {
+    uint16_t version;          ///< ʽ汾ReplayWriter::kFormatVersion
+    MatchRuleType matchRule;   ///< ƥ
+    uint64_t levelHash;        ///< ؿʶɫ LevelSignature
+    uint64_t seed;             ///< ؿӣֹؿΪ 0
+    uint32_t moveCount;        ///< 
+    uint32_t streamBytes;      ///< ֽ
+    uint16_t indexInterval;    ///< λļ
+
+    ReplayHeader()
+        : version(0), matchRule(MRT_TRIPEAKS), levelHash(0), seed(0), moveCount(0), streamBytes(0), indexInterval(0) {}
+};
+
+/**
+ * @struct ReplayMove
+ * @brief һ
+ */
+struct ReplayMove {
+    int move;          ///< Ϸ±꣬ SMC_DRAW / SMC_UNDO GameSession һ£
+    uint32_t timeMs;   ///< ࿪ֵĺ
+};
+
+/**
+ * @class ReplayWriter
+ * @brief طű
+ *
+ * ְ
+ * - ׷Ӳʱ䣬ʱһĻطţļͷλ
+ *
+ * ʹó
+ * GameController ¼ƱضԾ֣tools/validation_host ıύתΪط
+ *
+ * ԭ
+ * - ÿ varintǣ 2 λΪͣʱλһεĿ±֮ zigzag 룩
+ *   ;һĺڿơڵĲ 3 ֽ
+ * - ÿ indexInterval һλƫơʱʱһεĿƣ϶ʱشͷ
+ * - жֶֽΰСֽֽдƽ̨޹أݻطſֱβӴһļ
+ */
+class ReplayWriter {
+public:
+    static const uint32_t kMagic = 0x50524d43;        ///< "CMRP"
+    static const uint16_t kFormatVersion = 1;
+    static const size_t kHeaderBytes = 36;            ///< ļͷֽ
+    static const size_t kIndexEntryBytes = 12;        ///< ÿλֽ
+    static const uint16_t kDefaultIndexInterval = 64;
+
+    ReplayWriter();
+
+    /**
+     * @brief ʼ¼һ֣֮ǰ
+     * @param levelHash ؿʶ
+     * @param seed ؿ
+     * @param matchRule ƥ
+     * @param indexInterval λļΪ 1
+     */
+    void begin(uint64_t levelHash, uint64_t seed, MatchRuleType matchRule,
+               uint16_t indexInterval = kDefaultIndexInterval);
+
+    /**
+     * @brief Ԥռ䣬¼ƹв
+     * @param moves ԤƵĲ
+     */
+    void reserve(size_t moves);
+
+    /**
+     * @brief ׷һ
+     * @param move Ϸ±꣬ SMC_DRAW / SMC_UNDO
+     * @param timeMs ࿪ֵĺһʱһ
+     */
+    void addMove(int move, uint32_t timeMs);
+
+    uint32_t getMoveCount() const { return _header.moveCount; }
+
+    /**
+     * @brief Ļط׷ӵ out
+     */
+    void finish(std::vector<uint8_t>& out) const;
+
+private:
+    ReplayHeader _header;
+    std::vector<uint8_t> _stream;    ///< 
+    std::vector<uint8_t> _index;     ///< ѱĶλ
+    uint32_t _lastTimeMs;            ///< һʱ
+    int _previousCard;               ///< һεĿ±
+};
+
+/**
+ * @class ReplayReader
+ * @brief طŽ
+ *
+ * ְ
+ * - Уļͷͳȣ˳λһ
+ *
+ * ʹó
+ * tools/validation_host طŻطļŽ϶ʱ seek
+ *
+ * ԭ
+ * - ֱӶȡ÷ڴ棬䣻ڶȡڼɵ÷֤Ч
+ * - ˳ֻ varint ͼӷʱ next  falseԽȡ
+ */
+class ReplayReader {
+public:
+    ReplayReader();
+
+    /**
+     * @brief һݻط
+     * @param data ط㣨Ƕݻطβӵļеһݣ
+     * @param size data ֮Ŀֽ
+     * @return ļͷ򳤶ȲϷ false
+     */
+    bool open(const uint8_t* data, size_t size);
+
+    const ReplayHeader& getHeader() const { return _header; }
+
+    /**
+     * @brief ݻطŵֽڶλβӵһ
+     */
+    size_t getEncodedSize() const;
+
+    /**
+     * @brief һ
+     * @param out 
+     * @return ѵβ𻵷 false
+     */
+    bool next(ReplayMove& out) {
+        if (_moveIndex >= _header.moveCount) return false;
+
+        uint64_t token;
+        uint64_t deltaMs;
+        if (!readVarint(token) || !readVarint(deltaMs)) {
+            _moveIndex = _header.moveCount;
+            return false;
+        }
+
+        switch (token & 3) {
+        case RT_CARD:
+            _previousCard += unzigzag(token >> 2);
+            out.move = _previousCard;
+            break;
+        case RT_DRAW: out.move = kMoveDraw; break;
+        default: out.move = kMoveUndo; break;
+        }
+        _timeMs += (uint32_t)deltaMs;
+        out.timeMs = _timeMs;
+        _moveIndex++;
+        return true;
+    }
+
+    /**
+     * @brief λ moveIndex ֮ next һʼ
+     * @return moveIndex 𻵷 false
+     */
+    bool seek(uint32_t moveIndex);
+
+    /**
+     * @brief һ next صĲ
+     */
+    uint32_t getPosition() const { return _moveIndex; }
+
+private:
+    static const int kMoveDraw = -1;   ///<  SMC_DRAW һ
+    static const int kMoveUndo = -2;   ///<  SMC_UNDO һ
+
+    static int unzigzag(uint64_t value) { return (int)(value >> 1) ^ -(int)(value & 1); }
+
+    bool readVarint(uint64_t& value) {
+        // ·ֽ
+        if (_cursor < _end && *_cursor < 0x80) {
+            value = *_cursor++;
+            return true;
+        }
+        value = 0;
+        for (int shift = 0; shift < 64 && _cursor < _end; shift += 7) {
+            uint8_t byte = *_cursor++;
+            value |= (uint64_t)(byte & 0x7f) << shift;
+            if (byte < 0x80) return true;
+        }
+        return false;
+    }
+
+    ReplayHeader _header;
+    const uint8_t* _stream;    ///< 
+    const uint8_t* _cursor;    ///< һֽ
+    const uint8_t* _end;       ///< յ
+    const uint8_t* _index;     ///< λ
+    uint32_t _indexCount;
+    uint32_t _moveIndex;       ///< һ
+    uint32_t _timeMs;          ///< һʱ
+    int _previousCard;         ///< һεĿ±
+};
+
+#endif
@@ -0,0 +1,53 @@
+// --------------------------------------------------------
+// ļ: Classes/utils/AllocationTracker.cpp
+// --------------------------------------------------------
+#include "AllocationTracker.h"
+
+#if CM_ENABLE_ALLOC_TRACKING
+
+#include <cstdlib>
+#include <new>
+
+namespace {
+    thread_local uint64_t t_allocCount = 0;
+    thread_local uint64_t t_allocBytes = 0;
+
+    void* countedAlloc(size_t size) {
+        t_allocCount++;
+        t_allocBytes += size;
+        return malloc(size ? size : 1);
+    }
+}
+
+uint64_t AllocationTracker::getThreadCount() { return t_allocCount; }
+uint64_t AllocationTracker::getThreadBytes() { return t_allocBytes; }
+
+// ===================== ȫַ亯滻 =====================
+// ֻڵԼڴ治ʱֱ׳ bad_alloc new_handler
+
+void* operator new(size_t size) {
+    void* ptr = countedAlloc(size);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](size_t size) {
+    void* ptr = countedAlloc(size);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return countedAlloc(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return countedAlloc(size); }
+
+void operator delete(void* ptr) noexcept { free(ptr); }
+void operator delete[](void* ptr) noexcept { free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { free(ptr); }
+
+#else
+
+uint64_t AllocationTracker::getThreadCount() { return 0; }
+uint64_t AllocationTracker::getThreadBytes() { return 0; }
+
+#endif // CM_ENABLE_ALLOC_TRACKING
@@ -0,0 +1,69 @@
+// --------------------------------------------------------
+// ļ: Classes/utils/AllocationTracker.h
+// --------------------------------------------------------
+#ifndef __ALLOCATION_TRACKER_H__
+#define __ALLOCATION_TRACKER_H__
+
+#include <cstdint>
+
+// أĬϸ׷ٿأֻ Debug 滻ȫ operator new/delete
+#ifndef CM_ENABLE_ALLOC_TRACKING
+#if defined(COCOS2D_DEBUG) && (COCOS2D_DEBUG > 0)
+#define CM_ENABLE_ALLOC_TRACKING 1
+#else
+#define CM_ENABLE_ALLOC_TRACKING 0
+#endif
+#endif
+
+/**
+ * @class AllocationTracker
+ * @brief ѷ
+ *
+ * ְ
+ * - 滻ȫ operator new/delete߳ۼƷֽ
+ *
+ * ʹó
+ * TraceScope ¼ÿ׷ڵķ
+ * AllocationBudgetRunner  AllocationScope ÿķǷ񳬳Ԥ
+ *
+ * ԭ
+ * - ֲ߳̾·
+ * - Release ²滻亯ѯӿں㷵 0
+ */
+class AllocationTracker {
+public:
+    /**
+     * @brief Ƿ
+     */
+    static bool isEnabled() { return CM_ENABLE_ALLOC_TRACKING != 0; }
+
+    /**
+     * @brief ǰ߳ۼƵķ
+     */
+    static uint64_t getThreadCount();
+
+    /**
+     * @brief ǰ߳ۼƷֽ
+     */
+    static uint64_t getThreadBytes();
+};
+
+/**
+ * @class AllocationScope
+ * @brief ͳһδеǰ̵߳ķ
+ */
+class AllocationScope {
+public:
+    AllocationScope()
+        : _startCount(AllocationTracker::getThreadCount())
+        , _startBytes(AllocationTracker::getThreadBytes()) {}
+
+    uint64_t getCount() const { return AllocationTracker::getThreadCount() - _startCount; }
+    uint64_t getBytes() const { return AllocationTracker::getThreadBytes() - _startBytes; }
+
+private:
+    uint64_t _startCount;
+    uint64_t _startBytes;
+};
+
+#endif // __ALLOCATION_TRACKER_H__
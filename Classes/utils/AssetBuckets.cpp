@@ -0,0 +1,56 @@
+#include "AssetBuckets.h"
+#include "Logger.h"
+#include <string>
+#include <vector>
+
+USING_NS_CC;
+
+const float AssetBuckets::kDesignWidth = 1080.0f;
+
+//  tools/asset_buckets/make_buckets.py е BUCKETS һ£ŴС
+const AssetBucket AssetBuckets::kBuckets[] = {
+    { "small", 0.5f },
+    { "medium", 1.0f },
+    { "large", 1.5f },
+};
+const int AssetBuckets::kBucketCount = sizeof(kBuckets) / sizeof(kBuckets[0]);
+
+const AssetBucket* AssetBuckets::s_active = nullptr;
+std::unordered_map<std::string, bool> AssetBuckets::s_prescaled;
+
+const AssetBucket& AssetBuckets::select(float frameWidth) {
+    float frameScale = frameWidth / kDesignWidth;
+    for (int i = 0; i < kBucketCount; i++) {
+        //  5% ԴڵλĻһ
+        if (kBuckets[i].scale >= frameScale * 0.95f) return kBuckets[i];
+    }
+    return kBuckets[kBucketCount - 1];
+}
+
+void AssetBuckets::apply(const Size& frameSize) {
+    const AssetBucket& bucket = select(frameSize.width);
+    std::string directory = std::string(bucket.directory) + "/";
+
+    // ҵλĿ¼λûеļ˵ԭʼ getRuntimeScale 
+    s_active = &bucket;
+    s_prescaled.clear();
+    FileUtils::getInstance()->setSearchResolutionsOrder(std::vector<std::string>{ directory, "" });
+    Director::getInstance()->setContentScaleFactor(bucket.scale);
+    CM_LOG_INFO(LC_ASSET, "Asset bucket '%s' (scale %.2f) for %.0fx%.0f frame",
+          bucket.directory, bucket.scale, frameSize.width, frameSize.height);
+}
+
+bool AssetBuckets::isPrescaled(const std::string& path) {
+    if (!s_active) return false;
+    auto it = s_prescaled.find(path);
+    if (it != s_prescaled.end()) return it->second;
+
+    bool exists = FileUtils::getInstance()->isFileExist(std::string(s_active->directory) + "/" + path);
+    s_prescaled[path] = exists;
+    return exists;
+}
+
+float AssetBuckets::getRuntimeScale(const std::string& path, float designScale) {
+    if (!s_active) return designScale;
+    return isPrescaled(path) ? 1.0f : designScale * s_active->scale;
+}
@@ -0,0 +1,77 @@
+#ifndef __ASSET_BUCKETS_H__
+#define __ASSET_BUCKETS_H__
+
+#include "cocos2d.h"
+#include <string>
+#include <unordered_map>
+
+/**
+ * @struct AssetBucket
+ * @brief һֱʵλ
+ */
+struct AssetBucket {
+    const char* directory;   ///< Resources µĵλĿ¼
+    float scale;             ///< λƷֱʵţ / Ƶλ
+};
+
+/**
+ * @class AssetBuckets
+ * @brief ֱʵλѡ
+ *
+ * ְ
+ * - ʱĻѡԤĵλԴ˳ ContentScaleFactor
+ * - ͼĳԴǷѰʾߴԤţԼ黹Ҫʱ
+ *
+ * ʹó
+ * AppDelegate Ʒֱʺ· applyCardViewGameView ƾʱ
+ * Դ· getRuntimeScale дķŴ
+ *
+ * ԭ
+ * - λ tools/asset_buckets/make_buckets.py ɣĿ¼ṹ Resources Ŀ¼һ£
+ *   ͨ FileUtils ķֱ˳ңشеļ
+ * - ѡСĻŵСλGPU ֻСλʱλ
+ * - smallmedium λֻ¼ԭʼļڴ治ԭʼ
+ *   ֻ large λŴڴ滻ȡ߷ϵ
+ * - λûеļ˵ԭʼ鰴ԭȵıԵλŷŴʾߴ粻
+ */
+class AssetBuckets {
+public:
+    static const float kDesignWidth;   ///< ƷֱʿȣƵλ
+
+    /**
+     * @brief Ļѡλ
+     * @param frameWidth Ļȣأ
+     * @return ѡеĵλ
+     */
+    static const AssetBucket& select(float frameWidth);
+
+    /**
+     * @brief ѡλӦõ FileUtils  Director
+     * @param frameSize Ļߴ磨أ
+     * @details ·֮󡢼κ֮ǰ
+     */
+    static void apply(const cocos2d::Size& frameSize);
+
+    /**
+     * @brief ԴǷеǰλԤŰ汾
+     * @param path  Resources Ŀ¼Դ·
+     */
+    static bool isPrescaled(const std::string& path);
+
+    /**
+     * @brief ʱ
+     * @param path ʹõԴ·
+     * @param designScale ԭʼ ContentScaleFactor Ϊ 1 ʱҪķŴ
+     * @return λиԴʱΪ 1ɹѰź決
+     *         Ϊ designScale Եλţ ContentScaleFactor ԭʼС
+     */
+    static float getRuntimeScale(const std::string& path, float designScale);
+
+private:
+    static const AssetBucket kBuckets[];
+    static const int kBucketCount;
+    static const AssetBucket* s_active;   ///< ǰλapply ֮ǰΪ nullptr
+    static std::unordered_map<std::string, bool> s_prescaled;   ///< Դ· -> λǷ
+};
+
+#endif
@@ -1,5 +1,35 @@
 #include "CardHelper.h"
 
+namespace {
+    // ±Ϊ face + 1 CFT_NONE-1 13ؿеĵȡ 1-13
+    const int kFaceSlots = CFT_NUM_CARD_FACE_TYPES + 2;
+
+    /**
+     * @brief ·ÿɫÿɫֻƴһ
+     */
+    struct ImageKeyTable {
+        std::string suits[CST_NUM_CARD_SUIT_TYPES];
+        std::string numbers[2][kFaceSlots];   ///< [Ƿɫ][face + 1]
+
+        ImageKeyTable() {
+            for (int suit = 0; suit < CST_NUM_CARD_SUIT_TYPES; suit++) {
+                suits[suit] = CardHelper::getSuitImagePath((CardSuitType)suit);
+            }
+            for (int black = 0; black < 2; black++) {
+                for (int slot = 0; slot < kFaceSlots; slot++) {
+                    numbers[black][slot] = CardHelper::getNumberImagePath((CardFaceType)(slot - 1), true, black != 0);
+                }
+            }
+        }
+    };
+
+    const ImageKeyTable& getImageKeyTable() {
+        // ھ̬ĳʼ̰߳ȫģԤ̶̺߳߳ȵ
+        static const ImageKeyTable table;
+        return table;
+    }
+}
+
 // ȡƻ·
 std::string CardHelper::getCardBasePath() {
     return "card_general.png";
@@ -39,6 +69,20 @@ std::string CardHelper::getNumberImagePath(CardFaceType face, bool isBig, bool i
     return "number/" + sizePrefix + colorPrefix + faceStr + ".png";
 }
 
+const std::string& CardHelper::getSuitImageKey(CardSuitType suit) {
+    int index = (suit >= 0 && suit < CST_NUM_CARD_SUIT_TYPES) ? (int)suit : (int)CST_CLUBS;
+    return getImageKeyTable().suits[index];
+}
+
+const std::string& CardHelper::getNumberImageKey(CardFaceType face, bool isBlack) {
+    int slot = ((int)face >= 0 && (int)face + 1 < kFaceSlots) ? (int)face + 1 : 0;
+    return getImageKeyTable().numbers[isBlack ? 1 : 0][slot];
+}
+
+void CardHelper::preloadImageKeys() {
+    getImageKeyTable();
+}
+
 // Ҫȡ·
 std::string CardHelper::getCardFrameName(CardSuitType suit, CardFaceType face) {
     // ﷵһռλʵҪCardView϶
@@ -60,6 +60,26 @@ public:
      * @return ͼƬԴ·
      */
     static std::string getNumberImagePath(CardFaceType face, bool isBig, bool isBlack);
+
+    /**
+     * @brief ȡĻɫͼ·ظòƴַ
+     * @param suit ƻɫԽʱ getSuitImagePath һ÷
+     * @return ̬·еַڼһֱЧ
+     */
+    static const std::string& getSuitImageKey(CardSuitType suit);
+
+    /**
+     * @brief ȡĴŵͼƬ·ظòƴַ
+     * @param face ƵԽʱ CFT_NONE 
+     * @param isBlack ǷΪɫ
+     * @return ̬·еַڼһֱЧ
+     */
+    static const std::string& getNumberImageKey(CardFaceType face, bool isBlack);
+
+    /**
+     * @brief ɻɫ / ·Ԥؿʼʱã״βʱٽ
+     */
+    static void preloadImageKeys();
 };
 
 #endif
\ No newline at end of file
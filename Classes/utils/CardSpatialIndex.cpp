@@ -0,0 +1,120 @@
+// --------------------------------------------------------
+// ļ: Classes/utils/CardSpatialIndex.cpp
+// --------------------------------------------------------
+#include "CardSpatialIndex.h"
+#include <algorithm>
+#include <cmath>
+
+USING_NS_CC;
+
+CardSpatialIndex::CardSpatialIndex()
+    : _cellSize(1.0f)
+    , _columns(0)
+    , _rows(0) {
+}
+
+void CardSpatialIndex::reset(const Rect& bounds, float cellSize) {
+    _bounds = bounds;
+    _cellSize = std::max(cellSize, 1.0f);
+    _columns = std::max(1, (int)std::ceil(bounds.size.width / _cellSize));
+    _rows = std::max(1, (int)std::ceil(bounds.size.height / _cellSize));
+    _cells.assign(_columns * _rows, std::vector<int>());
+    _entries.clear();
+}
+
+void CardSpatialIndex::moveBounds(const Vec2& origin) {
+    if (_bounds.origin.equals(origin)) return;
+
+    std::vector<Entry> entries;
+    entries.reserve(_entries.size());
+    for (const auto& item : _entries) {
+        entries.push_back(item.second);
+    }
+
+    clear();
+    _bounds.origin = origin;
+    for (const Entry& entry : entries) {
+        insert(entry.cardId, entry.rect, entry.zOrder, entry.active);
+    }
+}
+
+void CardSpatialIndex::clear() {
+    for (auto& cell : _cells) {
+        cell.clear();
+    }
+    _entries.clear();
+}
+
+int CardSpatialIndex::columnOf(float x) const {
+    int column = (int)std::floor((x - _bounds.origin.x) / _cellSize);
+    return std::min(std::max(column, 0), _columns - 1);
+}
+
+int CardSpatialIndex::rowOf(float y) const {
+    int row = (int)std::floor((y - _bounds.origin.y) / _cellSize);
+    return std::min(std::max(row, 0), _rows - 1);
+}
+
+void CardSpatialIndex::insert(int cardId, const Rect& rect, int zOrder, bool active) {
+    if (_cells.empty()) return;
+    remove(cardId);
+
+    Entry entry;
+    entry.cardId = cardId;
+    entry.rect = rect;
+    entry.zOrder = zOrder;
+    entry.active = active;
+    _entries[cardId] = entry;
+
+    int minColumn = columnOf(rect.getMinX());
+    int maxColumn = columnOf(rect.getMaxX());
+    int minRow = rowOf(rect.getMinY());
+    int maxRow = rowOf(rect.getMaxY());
+    for (int row = minRow; row <= maxRow; row++) {
+        for (int column = minColumn; column <= maxColumn; column++) {
+            _cells[row * _columns + column].push_back(cardId);
+        }
+    }
+}
+
+void CardSpatialIndex::remove(int cardId) {
+    auto it = _entries.find(cardId);
+    if (it == _entries.end()) return;
+
+    const Rect& rect = it->second.rect;
+    int minColumn = columnOf(rect.getMinX());
+    int maxColumn = columnOf(rect.getMaxX());
+    int minRow = rowOf(rect.getMinY());
+    int maxRow = rowOf(rect.getMaxY());
+    for (int row = minRow; row <= maxRow; row++) {
+        for (int column = minColumn; column <= maxColumn; column++) {
+            auto& cell = _cells[row * _columns + column];
+            cell.erase(std::remove(cell.begin(), cell.end(), cardId), cell.end());
+        }
+    }
+    _entries.erase(it);
+}
+
+void CardSpatialIndex::setActive(int cardId, bool active) {
+    auto it = _entries.find(cardId);
+    if (it != _entries.end()) {
+        it->second.active = active;
+    }
+}
+
+int CardSpatialIndex::hitTest(const Vec2& point) const {
+    if (_cells.empty()) return -1;
+
+    int hitId = -1;
+    int hitZ = 0;
+    const auto& cell = _cells[rowOf(point.y) * _columns + columnOf(point.x)];
+    for (int cardId : cell) {
+        const Entry& entry = _entries.at(cardId);
+        if (!entry.active || !entry.rect.containsPoint(point)) continue;
+        if (hitId < 0 || entry.zOrder > hitZ) {
+            hitId = cardId;
+            hitZ = entry.zOrder;
+        }
+    }
+    return hitId;
+}
\ No newline at end of file
@@ -0,0 +1,100 @@
+// --------------------------------------------------------
+// ļ: Classes/utils/CardSpatialIndex.h
+// --------------------------------------------------------
+#ifndef __CARD_SPATIAL_INDEX_H__
+#define __CARD_SPATIAL_INDEX_H__
+
+#include "cocos2d.h"
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class CardSpatialIndex
+ * @brief ϷƵľռ
+ *
+ * ְ
+ * - ƵĵΰѿƵǼǵǵԪ
+ * - ʱֻ鴥ڵԪеĿƣ Z ߵĿɵ
+ *
+ * ʹó
+ *  GameView УϷΨһĴͨѴַ
+ *
+ * ԭ
+ * - ԵĿֻ뵥Ԫڿйأ濨
+ * - ֻ洢 ID ;Σͼģ
+ */
+class CardSpatialIndex {
+public:
+    CardSpatialIndex();
+
+    /**
+     * @brief 
+     * @param bounds ǵϷ꣩ĿƹԵԪ
+     * @param cellSize Ԫ߳
+     */
+    void reset(const cocos2d::Rect& bounds, float cellSize);
+
+    /**
+     * @brief ƽǵ򣬱ѵǼǵĿ
+     * @param origin ½ǣϷ꣩ߴ͵Ԫ߳
+     * @details ϷʱɼѵǼǵĿư¹뵥Ԫ
+     */
+    void moveBounds(const cocos2d::Vec2& origin);
+
+    /**
+     * @brief пƣ񻮷
+     */
+    void clear();
+
+    /**
+     * @brief Ǽǻһſ
+     * @param cardId  ID
+     * @param rect ΣϷ꣩
+     * @param zOrder Z ԽԽ
+     * @param active Ƿɵ泯ϣ
+     */
+    void insert(int cardId, const cocos2d::Rect& rect, int zOrder, bool active);
+
+    /**
+     * @brief Ƴһſƣʱ
+     * @param cardId  ID
+     */
+    void remove(int cardId);
+
+    /**
+     * @brief ÿǷɵʱ
+     * @param cardId  ID
+     * @param active Ƿɵ
+     */
+    void setActive(int cardId, bool active);
+
+    /**
+     * @brief 
+     * @param point 㣨Ϸ꣩
+     * @return Ŀɵ Z ߵ IDûз -1
+     */
+    int hitTest(const cocos2d::Vec2& point) const;
+
+private:
+    struct Entry {
+        int cardId;
+        cocos2d::Rect rect;
+        int zOrder;
+        bool active;
+    };
+
+    /**
+     * @brief ڵ/УΧʱضϵԵ
+     */
+    int columnOf(float x) const;
+    int rowOf(float y) const;
+
+    cocos2d::Rect _bounds;                        ///< 
+    float _cellSize;                              ///< Ԫ߳
+    int _columns;                                 ///< 
+    int _rows;                                    ///< 
+    std::vector<std::vector<int>> _cells;         ///< ÿԪеĿ ID
+    std::unordered_map<int, Entry> _entries;      ///<  ID -> ǼϢ
+};
+
+#endif // __CARD_SPATIAL_INDEX_H__
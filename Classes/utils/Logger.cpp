@@ -0,0 +1,290 @@
+// Classes/utils/Logger.cpp
+#include "Logger.h"
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+
+#if defined(__ANDROID__)
+#include <android/log.h>
+#elif defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#endif
+
+namespace {
+    const size_t kLineBytes = 1024;   ///< һ־ޣֽضϣ
+
+    const char* const kLevelNames[] = { "TRACE", "DEBUG", "INFO", "WARN", "ERROR", "OFF" };
+    const char* const kCategoryNames[] = { "app", "input", "game", "render", "asset", "perf" };
+
+    static_assert((Logger::kCapacity & (Logger::kCapacity - 1)) == 0, "Logger::kCapacity must be a power of two");
+    static_assert(sizeof(kCategoryNames) / sizeof(kCategoryNames[0]) == LC_COUNT, "category names out of sync");
+
+    /**
+     * @brief 򶨳׷Ӹʽıµдλã capacity - 1
+     */
+    size_t appendf(char* out, size_t used, size_t capacity, const char* format, ...) {
+        if (used + 1 >= capacity) return used;
+        va_list args;
+        va_start(args, format);
+        int written = vsnprintf(out + used, capacity - used, format, args);
+        va_end(args);
+        if (written < 0) return used;
+        return std::min(used + (size_t)written, capacity - 1);
+    }
+
+    long long argAsInt(const LogArg& arg) {
+        switch (arg.type) {
+            case LogArg::LAT_DOUBLE: return (long long)arg.d;
+            case LogArg::LAT_POINTER: return (long long)(intptr_t)arg.p;
+            default: return arg.i;
+        }
+    }
+
+    double argAsDouble(const LogArg& arg) {
+        switch (arg.type) {
+            case LogArg::LAT_INT: return (double)arg.i;
+            case LogArg::LAT_UINT: return (double)arg.u;
+            case LogArg::LAT_DOUBLE: return arg.d;
+            default: return 0.0;
+        }
+    }
+}
+
+const int Logger::kCapacity;
+const int Logger::kWakeThreshold;
+const int Logger::kBatchDelayMs;
+
+Logger* Logger::getInstance() {
+    static Logger instance;
+    return &instance;
+}
+
+Logger::Logger()
+    : _enqueuePosition(0)
+    , _dequeuePosition(0)
+    , _dropped(0)
+    , _reportedDropped(0)
+    , _start(std::chrono::steady_clock::now())
+    , _writerIdle(false)
+    , _wakeRequested(false)
+    , _flushRequested(false)
+    , _stopping(false) {
+    for (size_t i = 0; i < (size_t)kCapacity; i++) {
+        _cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    _writer = std::thread(&Logger::writerLoop, this);
+}
+
+Logger::~Logger() {
+    {
+        std::lock_guard<std::mutex> lock(_wakeMutex);
+        _stopping = true;
+    }
+    _wake.notify_one();
+    if (_writer.joinable()) _writer.join();
+    drain();
+}
+
+Logger::Cell* Logger::claim(size_t& position) {
+    size_t pos = _enqueuePosition.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell* cell = &_cells[pos & (kCapacity - 1)];
+        size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+        if (diff == 0) {
+            if (_enqueuePosition.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                position = pos;
+                return cell;
+            }
+        }
+        else if (diff < 0) {
+            // λûд߳ȡߣ
+            return nullptr;
+        }
+        else {
+            pos = _enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void Logger::captureString(LogRecord& record, const char* text, size_t length) {
+    LogArg& arg = nextArg(record, LogArg::LAT_STRING);
+    size_t available = LogRecord::kTextBytes - record.textLength;
+    if (available == 0) {
+        // ıָһַĽβ
+        arg.textOffset = (uint16_t)(LogRecord::kTextBytes - 1);
+        return;
+    }
+    size_t copied = std::min(length, available - 1);
+    memcpy(record.text + record.textLength, text, copied);
+    record.text[record.textLength + copied] = '\0';
+    arg.textOffset = record.textLength;
+    record.textLength = (uint16_t)(record.textLength + copied + 1);
+}
+
+void Logger::flush() {
+    drain();
+}
+
+void Logger::wakeWriter(bool urgent) {
+    {
+        std::lock_guard<std::mutex> lock(_wakeMutex);
+        _wakeRequested = true;
+        if (urgent) _flushRequested = true;
+    }
+    _wake.notify_one();
+}
+
+bool Logger::hasPending() {
+    std::lock_guard<std::mutex> lock(_drainMutex);
+    const Cell& cell = _cells[_dequeuePosition & (kCapacity - 1)];
+    return cell.sequence.load(std::memory_order_seq_cst) == _dequeuePosition + 1;
+}
+
+void Logger::writerLoop() {
+    std::unique_lock<std::mutex> lock(_wakeMutex);
+    while (!_stopping) {
+        // ټ黺壺֮дļ¼һܿ _writerIdle 
+        _writerIdle.store(true, std::memory_order_seq_cst);
+        if (!_flushRequested && !hasPending()) {
+            _wake.wait(lock, [this]() { return _stopping || _wakeRequested; });
+        }
+        _writerIdle.store(false, std::memory_order_seq_cst);
+        _wakeRequested = false;
+
+        // ȵﵽֵ ERROR ¼ʱ
+        _wake.wait_for(lock, std::chrono::milliseconds(kBatchDelayMs),
+                       [this]() { return _stopping || _flushRequested; });
+        _flushRequested = false;
+
+        lock.unlock();
+        drain();
+        lock.lock();
+    }
+}
+
+void Logger::drain() {
+    std::lock_guard<std::mutex> lock(_drainMutex);
+    char line[kLineBytes];
+    bool wrote = false;
+
+    for (;;) {
+        Cell* cell = &_cells[_dequeuePosition & (kCapacity - 1)];
+        size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        if (sequence != _dequeuePosition + 1) break;
+
+        formatRecord(cell->record, line, sizeof(line));
+        cell->sequence.store(_dequeuePosition + kCapacity, std::memory_order_release);
+        _dequeuePosition++;
+
+        emit(line);
+        wrote = true;
+    }
+
+    uint64_t dropped = _dropped.load(std::memory_order_relaxed);
+    if (dropped != _reportedDropped) {
+        snprintf(line, sizeof(line), "[Logger] %llu records dropped (buffer full)",
+                 (unsigned long long)(dropped - _reportedDropped));
+        _reportedDropped = dropped;
+        emit(line);
+        wrote = true;
+    }
+
+    if (wrote) fflush(stdout);
+}
+
+void Logger::formatRecord(const LogRecord& record, char* out, size_t capacity) {
+    size_t used = appendf(out, 0, capacity, "[%9.3f] %-5s %-6s ", record.timeNs / 1e9,
+                          kLevelNames[std::min<int>(record.level, LL_OFF)],
+                          record.category < LC_COUNT ? kCategoryNames[record.category] : "?");
+
+    // νʽıֱӿÿת˵Ĳװ󽻸 snprintf
+    // ͳһ long long ô %d / %u / %llu ȳζ滻Ϊ ll
+    const char* f = record.format;
+    int argIndex = 0;
+    while (*f && used + 1 < capacity) {
+        if (*f != '%') {
+            out[used++] = *f++;
+            continue;
+        }
+        if (f[1] == '%') {
+            out[used++] = '%';
+            f += 2;
+            continue;
+        }
+
+        char spec[32];
+        size_t specLength = 0;
+        spec[specLength++] = *f++;
+        while (*f && strchr("-+ #0123456789.", *f) && specLength < sizeof(spec) - 4) {
+            spec[specLength++] = *f++;
+        }
+        while (*f && strchr("hlLqjzt", *f)) f++;
+        char conversion = *f;
+        if (!conversion) break;
+        f++;
+
+        if (argIndex >= record.argCount) {
+            used = appendf(out, used, capacity, "<?>");
+            continue;
+        }
+        const LogArg& arg = record.args[argIndex++];
+
+        switch (conversion) {
+            case 'd': case 'i':
+                spec[specLength++] = 'l';
+                spec[specLength++] = 'l';
+                spec[specLength++] = conversion;
+                spec[specLength] = '\0';
+                used = appendf(out, used, capacity, spec, argAsInt(arg));
+                break;
+            case 'u': case 'x': case 'X': case 'o':
+                spec[specLength++] = 'l';
+                spec[specLength++] = 'l';
+                spec[specLength++] = conversion;
+                spec[specLength] = '\0';
+                used = appendf(out, used, capacity, spec, (unsigned long long)argAsInt(arg));
+                break;
+            case 'c':
+                spec[specLength++] = 'c';
+                spec[specLength] = '\0';
+                used = appendf(out, used, capacity, spec, (int)argAsInt(arg));
+                break;
+            case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+                spec[specLength++] = conversion;
+                spec[specLength] = '\0';
+                used = appendf(out, used, capacity, spec, argAsDouble(arg));
+                break;
+            case 's':
+                spec[specLength++] = 's';
+                spec[specLength] = '\0';
+                used = appendf(out, used, capacity, spec,
+                               arg.type == LogArg::LAT_STRING ? record.text + arg.textOffset : "<?>");
+                break;
+            case 'p':
+                used = appendf(out, used, capacity, "%p", arg.type == LogArg::LAT_POINTER ? arg.p : nullptr);
+                break;
+            default:
+                used = appendf(out, used, capacity, "<?>");
+                break;
+        }
+    }
+    out[used] = '\0';
+}
+
+void Logger::emit(const char* line) {
+#if defined(__ANDROID__)
+    __android_log_write(ANDROID_LOG_DEBUG, "cardmatch", line);
+#elif defined(_WIN32)
+    OutputDebugStringA(line);
+    OutputDebugStringA("\n");
+    fputs(line, stdout);
+    fputc('\n', stdout);
+#else
+    fputs(line, stdout);
+    fputc('\n', stdout);
+#endif
+}
@@ -0,0 +1,314 @@
+// Classes/utils/Logger.h
+#ifndef __LOGGER_H__
+#define __LOGGER_H__
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * @enum LogLevel
+ * @brief ־
+ */
+enum LogLevel {
+    LL_TRACE,   ///< ֡δϸ
+    LL_DEBUG,   ///< Ϣ
+    LL_INFO,    ///< ̽ڵͳ
+    LL_WARN,    ///< ɻָ쳣
+    LL_ERROR,   ///< 
+    LL_OFF      ///< ر
+};
+
+/**
+ * @enum LogCategory
+ * @brief ־࣬ÿ൥ñڼ
+ */
+enum LogCategory {
+    LC_APP,      ///< 
+    LC_INPUT,    ///< 
+    LC_GAME,     ///< ؿԾ߼
+    LC_RENDER,   ///< ͼ
+    LC_ASSET,    ///< Դ
+    LC_PERF,     ///< ͳ
+    LC_COUNT
+};
+
+// ڼ𣺵ڷ༶־ֵͬһ𱻱ɾ
+// ڱѡаาǣ -DCM_LOG_LEVEL_INPUT=LL_TRACE
+#ifndef CM_LOG_LEVEL_DEFAULT
+#if defined(COCOS2D_DEBUG) && COCOS2D_DEBUG > 0
+#define CM_LOG_LEVEL_DEFAULT LL_DEBUG
+#else
+#define CM_LOG_LEVEL_DEFAULT LL_WARN
+#endif
+#endif
+
+#ifndef CM_LOG_LEVEL_APP
+#define CM_LOG_LEVEL_APP CM_LOG_LEVEL_DEFAULT
+#endif
+#ifndef CM_LOG_LEVEL_INPUT
+#define CM_LOG_LEVEL_INPUT CM_LOG_LEVEL_DEFAULT
+#endif
+#ifndef CM_LOG_LEVEL_GAME
+#define CM_LOG_LEVEL_GAME CM_LOG_LEVEL_DEFAULT
+#endif
+#ifndef CM_LOG_LEVEL_RENDER
+#define CM_LOG_LEVEL_RENDER CM_LOG_LEVEL_DEFAULT
+#endif
+#ifndef CM_LOG_LEVEL_ASSET
+#define CM_LOG_LEVEL_ASSET CM_LOG_LEVEL_DEFAULT
+#endif
+#ifndef CM_LOG_LEVEL_PERF
+#define CM_LOG_LEVEL_PERF CM_LOG_LEVEL_DEFAULT
+#endif
+
+/**
+ * @brief ıͼ
+ */
+constexpr int cmLogMinLevel(int category) {
+    return category == LC_APP ? CM_LOG_LEVEL_APP
+        : category == LC_INPUT ? CM_LOG_LEVEL_INPUT
+        : category == LC_GAME ? CM_LOG_LEVEL_GAME
+        : category == LC_RENDER ? CM_LOG_LEVEL_RENDER
+        : category == LC_ASSET ? CM_LOG_LEVEL_ASSET
+        : category == LC_PERF ? CM_LOG_LEVEL_PERF
+        : LL_OFF;
+}
+
+/**
+ * @brief дһ־
+ * @details ʽַָֻ룬д̸߳ʽ
+ *          ǳʽ˵䲻ֵ
+ */
+#define CM_LOG(category, level, ...) \
+    do { \
+        if ((int)(level) >= cmLogMinLevel(category)) Logger::getInstance()->write((category), (level), __VA_ARGS__); \
+    } while (0)
+
+#define CM_LOG_TRACE(category, ...) CM_LOG(category, LL_TRACE, __VA_ARGS__)
+#define CM_LOG_DEBUG(category, ...) CM_LOG(category, LL_DEBUG, __VA_ARGS__)
+#define CM_LOG_INFO(category, ...)  CM_LOG(category, LL_INFO, __VA_ARGS__)
+#define CM_LOG_WARN(category, ...)  CM_LOG(category, LL_WARN, __VA_ARGS__)
+#define CM_LOG_ERROR(category, ...) CM_LOG(category, LL_ERROR, __VA_ARGS__)
+
+/**
+ * @struct LogArg
+ * @brief һƱĸʽ
+ */
+struct LogArg {
+    enum Type : uint8_t { LAT_INT, LAT_UINT, LAT_DOUBLE, LAT_STRING, LAT_POINTER };
+
+    Type type;
+    union {
+        long long i;
+        unsigned long long u;
+        double d;
+        const void* p;
+        uint16_t textOffset;   ///< LAT_STRINGַڼ¼ıеƫ
+    };
+};
+
+/**
+ * @struct LogRecord
+ * @brief λеһ־
+ */
+struct LogRecord {
+    static const int kMaxArgs = 8;        ///< 
+    static const int kTextBytes = 128;    ///< ַĿСֽضϣ
+
+    int64_t timeNs;            ///< дʱ䣨־ϵͳ
+    const char* format;        ///< ʽַ
+    uint8_t category;
+    uint8_t level;
+    uint8_t argCount;
+    uint16_t textLength;       ///< ıֽ
+    LogArg args[kMaxArgs];
+    char text[kTextBytes];
+};
+
+/**
+ * @class Logger
+ * @brief 첽־
+ *
+ * ְ
+ * - ־ֻʱ䡢ʽָͶƲдλ
+ * - ̨߳ȡ¼ʽƽ̨־Android logcatWindows ׼
+ *
+ * ʹó
+ * ͨ CM_LOG_* ã CCLOG  AppDelegate е DebugLog
+ * ˳ǰ flush
+ *
+ * ԭ
+ * - ߵߵĶλ壨ÿλţдֻһ CAS Ͷڴ
+ * - дʱ¼¼־
+ * - д߳ڻΪʱڵȴкĵһ¼ kBatchDelayMs ͳһд
+ *   ÿд kWakeThreshold  ERROR ¼ʱд澲ֹû־ʱ
+ * - ַдʱֵ棬ʽȫд߳
+ * - ༶ڱڹˣ˵䲻κδ
+ */
+class Logger {
+public:
+    static const int kCapacity = 1024;    ///< λļ¼2 ݣ
+    static const int kWakeThreshold = kCapacity / 4;   ///< ÿдô¼д̣߳2 ݣ
+    static const int kBatchDelayMs = 200;     ///< кһ¼ʱд߳ȴʱ
+
+    static Logger* getInstance();
+
+    /**
+     * @brief дһ־¼
+     * @param category 
+     * @param level 
+     * @param format ʽַprintf ﷨
+     * @param args 㡢C ַstd::string ָ
+     */
+    template <typename... Args>
+    void write(int category, int level, const char* format, const Args&... args) {
+        static_assert(sizeof...(Args) <= LogRecord::kMaxArgs, "too many log arguments");
+
+        size_t position;
+        Cell* cell = claim(position);
+        if (!cell) {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        LogRecord& record = cell->record;
+        record.timeNs = nowNs();
+        record.format = format;
+        record.category = (uint8_t)category;
+        record.level = (uint8_t)level;
+        record.argCount = 0;
+        record.textLength = 0;
+        capture(record, args...);
+
+        // д̶߳ _writerIdle ļ鹹 store-load ԣ˳һµ
+        cell->sequence.store(position + 1, std::memory_order_seq_cst);
+        bool urgent = level >= LL_ERROR || ((position + 1) & (kWakeThreshold - 1)) == 0;
+        if (urgent || _writerIdle.load(std::memory_order_seq_cst)) {
+            wakeWriter(urgent);
+        }
+    }
+
+    /**
+     * @brief ڵ߳дем¼
+     * @details ˳exitǰã֤־ʧ
+     */
+    void flush();
+
+    /**
+     * @brief 򻺳дļ¼
+     */
+    uint64_t getDroppedCount() const { return _dropped.load(std::memory_order_relaxed); }
+
+private:
+    /**
+     * @struct Cell
+     * @brief λĲλ
+     */
+    struct Cell {
+        std::atomic<size_t> sequence;   ///< дλʱддλ + 1 ʱɶ
+        LogRecord record;
+    };
+
+    Logger();
+    ~Logger();
+
+    /**
+     * @brief ȡһдλ
+     * @param position ȡдλ
+     * @return λ nullptr
+     */
+    Cell* claim(size_t& position);
+
+    int64_t nowNs() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start).count();
+    }
+
+    // ----  ----
+    static void capture(LogRecord&) {}
+
+    template <typename T, typename... Rest>
+    static void capture(LogRecord& record, const T& first, const Rest&... rest) {
+        captureArg(record, first);
+        capture(record, rest...);
+    }
+
+    static LogArg& nextArg(LogRecord& record, LogArg::Type type) {
+        LogArg& arg = record.args[record.argCount++];
+        arg.type = type;
+        return arg;
+    }
+
+    static void captureArg(LogRecord& r, char v) { nextArg(r, LogArg::LAT_INT).i = v; }
+    static void captureArg(LogRecord& r, signed char v) { nextArg(r, LogArg::LAT_INT).i = v; }
+    static void captureArg(LogRecord& r, unsigned char v) { nextArg(r, LogArg::LAT_UINT).u = v; }
+    static void captureArg(LogRecord& r, short v) { nextArg(r, LogArg::LAT_INT).i = v; }
+    static void captureArg(LogRecord& r, unsigned short v) { nextArg(r, LogArg::LAT_UINT).u = v; }
+    static void captureArg(LogRecord& r, int v) { nextArg(r, LogArg::LAT_INT).i = v; }
+    static void captureArg(LogRecord& r, unsigned int v) { nextArg(r, LogArg::LAT_UINT).u = v; }
+    static void captureArg(LogRecord& r, long v) { nextArg(r, LogArg::LAT_INT).i = v; }
+    static void captureArg(LogRecord& r, unsigned long v) { nextArg(r, LogArg::LAT_UINT).u = v; }
+    static void captureArg(LogRecord& r, long long v) { nextArg(r, LogArg::LAT_INT).i = v; }
+    static void captureArg(LogRecord& r, unsigned long long v) { nextArg(r, LogArg::LAT_UINT).u = v; }
+    static void captureArg(LogRecord& r, bool v) { nextArg(r, LogArg::LAT_INT).i = v ? 1 : 0; }
+    static void captureArg(LogRecord& r, float v) { nextArg(r, LogArg::LAT_DOUBLE).d = v; }
+    static void captureArg(LogRecord& r, double v) { nextArg(r, LogArg::LAT_DOUBLE).d = v; }
+    static void captureArg(LogRecord& r, const char* v) { captureString(r, v ? v : "(null)", v ? strlen(v) : 6); }
+    static void captureArg(LogRecord& r, char* v) { captureArg(r, (const char*)v); }
+    static void captureArg(LogRecord& r, const std::string& v) { captureString(r, v.c_str(), v.size()); }
+
+    template <typename T>
+    static void captureArg(LogRecord& r, T* v) { nextArg(r, LogArg::LAT_POINTER).p = v; }
+
+    static void captureString(LogRecord& record, const char* text, size_t length);
+
+    // ---- д߳ ----
+    void writerLoop();
+
+    /**
+     * @brief д߳
+     * @param urgent true ʾдfalse ʾӿ״̬ʼ
+     */
+    void wakeWriter(bool urgent);
+
+    /**
+     * @brief Ƿδȡļ¼
+     */
+    bool hasPending();
+
+    /**
+     * @brief ȡпɶ¼
+     */
+    void drain();
+
+    /**
+     * @brief һ¼ʽΪһı
+     */
+    static void formatRecord(const LogRecord& record, char* out, size_t capacity);
+
+    static void emit(const char* line);
+
+    Cell _cells[kCapacity];
+    std::atomic<size_t> _enqueuePosition;     ///< һдλã߹
+    size_t _dequeuePosition;                  ///< һȡλã _drainMutex 
+    std::atomic<uint64_t> _dropped;           ///< ļ¼
+    uint64_t _reportedDropped;                ///< ѱĶ
+    std::chrono::steady_clock::time_point _start;
+
+    std::mutex _drainMutex;                   ///< ֻ֮以⣨д߳ flush
+    std::mutex _wakeMutex;
+    std::condition_variable _wake;
+    std::atomic<bool> _writerIdle;            ///< д߳ڣ򼴽ڵȴ
+    bool _wakeRequested;                      ///< ״̬¼¼ _wakeMutex 
+    bool _flushRequested;                     ///< Ҫд _wakeMutex 
+    bool _stopping;
+    std::thread _writer;
+};
+
+#endif
@@ -0,0 +1,60 @@
+// --------------------------------------------------------
+// ļ: Classes/utils/MonotonicArena.cpp
+// --------------------------------------------------------
+#include "MonotonicArena.h"
+#include <cstdint>
+
+const size_t MonotonicArena::kDefaultBlockSize;
+
+MonotonicArena::MonotonicArena(size_t blockSize)
+    : _blockSize(blockSize ? blockSize : kDefaultBlockSize)
+    , _current(0)
+    , _offset(0) {
+}
+
+MonotonicArena::~MonotonicArena() {
+    for (const auto& block : _blocks) {
+        delete[] block.data;
+    }
+}
+
+void* MonotonicArena::allocate(size_t size, size_t alignment) {
+    while (_current < _blocks.size()) {
+        Block& block = _blocks[_current];
+        uintptr_t base = reinterpret_cast<uintptr_t>(block.data);
+        uintptr_t aligned = (base + _offset + alignment - 1) & ~(uintptr_t)(alignment - 1);
+        size_t end = (size_t)(aligned - base) + size;
+        if (end <= block.size) {
+            _offset = end;
+            return reinterpret_cast<void*>(aligned);
+        }
+
+        // ǰŲ£һĿ
+        _current++;
+        _offset = 0;
+    }
+
+    // п鶼꣺¿飨󵥶һ㹻Ŀ飩
+    Block block;
+    block.size = size + alignment > _blockSize ? size + alignment : _blockSize;
+    block.data = new (std::nothrow) char[block.size];
+    if (!block.data) return nullptr;
+
+    _blocks.push_back(block);
+    _current = _blocks.size() - 1;
+    _offset = 0;
+    return allocate(size, alignment);
+}
+
+void MonotonicArena::reset() {
+    _current = 0;
+    _offset = 0;
+}
+
+size_t MonotonicArena::getUsedBytes() const {
+    size_t used = _offset;
+    for (size_t i = 0; i < _current && i < _blocks.size(); i++) {
+        used += _blocks[i].size;
+    }
+    return used;
+}
@@ -0,0 +1,87 @@
+// --------------------------------------------------------
+// ļ: Classes/utils/MonotonicArena.h
+// --------------------------------------------------------
+#ifndef __MONOTONIC_ARENA_H__
+#define __MONOTONIC_ARENA_H__
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+/**
+ * @class MonotonicArena
+ * @brief ڴ
+ *
+ * ְ
+ * - ԤĴڴа˳зС飬ֻƶָ
+ * - reset() һԻȫڴ棬ڴ鹩´θ
+ *
+ * ʹó
+ * ͬһһϷһУỰͳһ䣬ʱ
+ *
+ * ԭ
+ * - ͷţҲֻʺϷ POD ݻйĶ
+ * - ÿ߳ / ỰԳһʵ
+ */
+class MonotonicArena {
+public:
+    static const size_t kDefaultBlockSize = 16 * 1024;  ///< ĬڴС
+
+    explicit MonotonicArena(size_t blockSize = kDefaultBlockSize);
+    ~MonotonicArena();
+
+    /**
+     * @brief һڴ
+     * @param size ֽ
+     * @param alignment 루 2 ݣ
+     * @return ڴַڴʧܷ nullptr
+     */
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * @brief  count  T ֵʼ
+     */
+    template <class T>
+    T* allocateArray(size_t count) {
+        void* memory = allocate(sizeof(T) * (count ? count : 1), alignof(T));
+        if (!memory) return nullptr;
+
+        T* items = static_cast<T*>(memory);
+        for (size_t i = 0; i < count; i++) {
+            new (items + i) T();
+        }
+        return items;
+    }
+
+    /**
+     * @brief ȫ䣬ڴ
+     * @note ֮ǰָȫʧЧᱻ
+     */
+    void reset();
+
+    /**
+     * @brief ǰѷֽ䣩
+     */
+    size_t getUsedBytes() const;
+
+    /**
+     * @brief ϵͳڴ
+     */
+    size_t getBlockCount() const { return _blocks.size(); }
+
+private:
+    MonotonicArena(const MonotonicArena&);
+    MonotonicArena& operator=(const MonotonicArena&);
+
+    struct Block {
+        char* data;
+        size_t size;
+    };
+
+    std::vector<Block> _blocks;   ///< ڴ飬reset 
+    size_t _blockSize;            ///< ڴĬϴС
+    size_t _current;              ///< ǰʹõڴ±
+    size_t _offset;               ///< ǰڴʹõֽ
+};
+
+#endif // __MONOTONIC_ARENA_H__
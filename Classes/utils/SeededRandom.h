@@ -0,0 +1,82 @@
+// --------------------------------------------------------
+// ļ: Classes/utils/SeededRandom.h
+// --------------------------------------------------------
+#ifndef __SEEDED_RANDOM_H__
+#define __SEEDED_RANDOM_H__
+
+#include <cstdint>
+
+/**
+ * @class SeededRandom
+ * @brief ƽ̨ȷαxoshiro256**Ӿ SplitMix64 չ
+ *
+ * ְ
+ * -  64 λȫȷ
+ * - ṩƫ [0, bound) 
+ *
+ * ʹó
+ * LevelMaterializer ؽؿͬһκƽ̨ͱ׼ϵõͬһ
+ *
+ * ԭ
+ * - ֻ 64 λ޷ļӷλͳ˷ rand()<random> ķֲʵֻ򸡵
+ */
+class SeededRandom {
+public:
+    explicit SeededRandom(uint64_t seed) { reseed(seed); }
+
+    /**
+     * @brief ״̬
+     */
+    void reseed(uint64_t seed) {
+        // SplitMix64 ӣ 0չɻص 4 ״̬
+        for (int i = 0; i < 4; i++) {
+            _state[i] = splitMix64(seed);
+        }
+    }
+
+    /**
+     * @brief һ 64 λ
+     */
+    uint64_t next() {
+        uint64_t result = rotl(_state[1] * 5, 7) * 9;
+        uint64_t t = _state[1] << 17;
+        _state[2] ^= _state[0];
+        _state[3] ^= _state[1];
+        _state[1] ^= _state[2];
+        _state[0] ^= _state[3];
+        _state[2] ^= t;
+        _state[3] = rotl(_state[3], 45);
+        return result;
+    }
+
+    /**
+     * @brief  [0, bound) ھȷֲ
+     * @param bound Ͻ磨 0
+     * @details ܾڲڵֱȡģƫ
+     */
+    uint32_t nextBelow(uint32_t bound) {
+        uint64_t threshold = (0 - (uint64_t)bound) % bound;
+        for (;;) {
+            uint64_t r = next();
+            if (r >= threshold) return (uint32_t)(r % bound);
+        }
+    }
+
+    /**
+     * @brief SplitMix64 Ҳ 64 λĻϺ
+     * @param x ״̬úǰһ
+     */
+    static uint64_t splitMix64(uint64_t& x) {
+        uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+private:
+    static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+    uint64_t _state[4];
+};
+
+#endif // __SEEDED_RANDOM_H__
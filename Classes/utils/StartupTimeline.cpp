@@ -0,0 +1,66 @@
+#include "StartupTimeline.h"
+#include "Logger.h"
+#include "cocos2d.h"
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+USING_NS_CC;
+
+namespace {
+    typedef std::chrono::steady_clock Clock;
+
+    struct Phase {
+        const char* name;
+        Clock::time_point time;
+    };
+
+    Phase s_phases[StartupTimeline::kMaxPhases];
+    int s_phaseCount = 0;
+    bool s_reported = false;
+
+    double millisecondsBetween(const Clock::time_point& from, const Clock::time_point& to) {
+        return std::chrono::duration<double, std::milli>(to - from).count();
+    }
+}
+
+void StartupTimeline::mark(const char* phase) {
+    if (s_reported || s_phaseCount >= kMaxPhases) return;
+    s_phases[s_phaseCount].name = phase;
+    s_phases[s_phaseCount].time = Clock::now();
+    s_phaseCount++;
+}
+
+double StartupTimeline::report() {
+    if (s_reported || s_phaseCount == 0) return 0.0;
+    s_reported = true;
+
+    const Clock::time_point& origin = s_phases[0].time;
+    double total = millisecondsBetween(origin, s_phases[s_phaseCount - 1].time);
+
+    // ־ÿ׶һУ;һ׶εĺʱ
+    std::string record;
+    char line[160];
+    CM_LOG_INFO(LC_PERF, "Startup timeline (%.1f ms to first interactive frame):", total);
+    for (int i = 0; i < s_phaseCount; i++) {
+        double atMs = millisecondsBetween(origin, s_phases[i].time);
+        double stepMs = i > 0 ? millisecondsBetween(s_phases[i - 1].time, s_phases[i].time) : 0.0;
+        CM_LOG_INFO(LC_PERF, "  %8.1f ms  +%7.1f ms  %s", atMs, stepMs, s_phases[i].name);
+
+        snprintf(line, sizeof(line), "%s%s=%.1f", i > 0 ? "," : "", s_phases[i].name, atMs);
+        record += line;
+    }
+
+    // ¼ļÿ׷һ
+    std::string path = FileUtils::getInstance()->getWritablePath() + "startup_timeline.txt";
+    FILE* file = fopen(path.c_str(), "a");
+    if (file) {
+        fprintf(file, "%s\n", record.c_str());
+        fclose(file);
+    }
+    return total;
+}
+
+bool StartupTimeline::isReported() {
+    return s_reported;
+}
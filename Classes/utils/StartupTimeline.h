@@ -0,0 +1,45 @@
+#ifndef __STARTUP_TIMELINE_H__
+#define __STARTUP_TIMELINE_H__
+
+/**
+ * @class StartupTimeline
+ * @brief ׶εĺʱ¼
+ *
+ * ְ
+ * -  main ʼ¼и׶εʱ
+ * - ׸ɽ֮֡׶κʱѱν׷ӵдĿ¼µ startup_timeline.txt
+ *   ڶԱȶ
+ *
+ * ʹó
+ * mainAppDelegate::applicationDidFinishLaunchingGameController::startGameGameView::init
+ * ״Ⱦ洦 markGameController ڵһλƳ report
+ *
+ * ԭ
+ * - ̬飬ڴ棬ʼ֮ǰ
+ * - ׶ַָֻ
+ * - report ֻһΣ֮ mark 
+ */
+class StartupTimeline {
+public:
+    static const int kMaxPhases = 24;   ///< ¼Ľ׶
+
+    /**
+     * @brief ¼һ׶εʱ
+     * @param phase ׶ַ
+     * @details һεõʱΪʱ
+     */
+    static void mark(const char* phase);
+
+    /**
+     * @brief ׶κʱд¼ļ
+     * @return ӵһ׶εһ׶εܺʱ룩
+     */
+    static double report();
+
+    /**
+     * @brief Ƿ
+     */
+    static bool isReported();
+};
+
+#endif
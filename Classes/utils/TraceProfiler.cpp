@@ -0,0 +1,195 @@
+// --------------------------------------------------------
+// ļ: Classes/utils/TraceProfiler.cpp
+// --------------------------------------------------------
+#include "TraceProfiler.h"
+
+#if CM_ENABLE_TRACE
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+namespace {
+    const std::chrono::steady_clock::time_point kProcessStart = std::chrono::steady_clock::now();
+
+    thread_local TraceThreadBuffer* t_threadBuffer = nullptr;
+
+    /**
+     * @brief ڵķλ
+     * @param sorted 
+     * @param q λ0~1
+     */
+    float percentileOf(const std::vector<float>& sorted, float q) {
+        if (sorted.empty()) return 0.0f;
+        size_t index = (size_t)(q * (sorted.size() - 1) + 0.5f);
+        return sorted[std::min(index, sorted.size() - 1)];
+    }
+
+    /**
+     * @brief  JSON ַʱתźͷб
+     */
+    void writeEscaped(FILE* fp, const char* text) {
+        for (const char* p = text; *p; ++p) {
+            if (*p == '"' || *p == '\\') fputc('\\', fp);
+            fputc(*p, fp);
+        }
+    }
+}
+
+// ===================== TraceThreadBuffer =====================
+
+const uint32_t TraceThreadBuffer::kCapacity;
+
+TraceThreadBuffer::TraceThreadBuffer(int threadIndex)
+    : _head(0)
+    , _tail(0)
+    , _dropped(0)
+    , _threadIndex(threadIndex) {
+}
+
+void TraceThreadBuffer::push(const char* name, uint64_t startNs, uint64_t durationNs, uint32_t allocations) {
+    uint32_t head = _head.load(std::memory_order_relaxed);
+    uint32_t tail = _tail.load(std::memory_order_acquire);
+    if (head - tail >= kCapacity) {
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    TraceEvent& slot = _events[head & (kCapacity - 1)];
+    slot.name = name;
+    slot.startNs = startNs;
+    slot.durationNs = durationNs;
+    slot.allocations = allocations;
+    _head.store(head + 1, std::memory_order_release);
+}
+
+void TraceThreadBuffer::drain(std::vector<TraceEvent>& out) {
+    uint32_t tail = _tail.load(std::memory_order_relaxed);
+    uint32_t head = _head.load(std::memory_order_acquire);
+    while (tail != head) {
+        out.push_back(_events[tail & (kCapacity - 1)]);
+        ++tail;
+    }
+    _tail.store(tail, std::memory_order_release);
+}
+
+// ===================== TraceProfiler =====================
+
+const size_t TraceProfiler::kWindowSize;
+const size_t TraceProfiler::kMaxExportEvents;
+
+TraceProfiler* TraceProfiler::getInstance() {
+    static TraceProfiler instance;
+    return &instance;
+}
+
+TraceProfiler::TraceProfiler() {
+    _scratch.reserve(TraceThreadBuffer::kCapacity);
+}
+
+uint64_t TraceProfiler::nowNs() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - kProcessStart).count();
+}
+
+TraceThreadBuffer* TraceProfiler::getThreadBuffer() {
+    if (!t_threadBuffer) {
+        // ÿֻ߳״ʱעһΣ֮д·ټ
+        std::lock_guard<std::mutex> lock(_registryMutex);
+        _buffers.emplace_back(new TraceThreadBuffer((int)_buffers.size()));
+        t_threadBuffer = _buffers.back().get();
+    }
+    return t_threadBuffer;
+}
+
+void TraceProfiler::record(const char* name, uint64_t startNs, uint64_t durationNs, uint32_t allocations) {
+    getThreadBuffer()->push(name, startNs, durationNs, allocations);
+}
+
+void TraceProfiler::collect() {
+    std::lock_guard<std::mutex> lock(_registryMutex);
+
+    for (auto& buffer : _buffers) {
+        _scratch.clear();
+        buffer->drain(_scratch);
+
+        for (const auto& event : _scratch) {
+            ScopeWindow& window = _windows[event.name];  // ֵʼΪȫ 0
+            window.samplesMs[window.next] = (float)(event.durationNs / 1.0e6);
+            window.allocSamples[window.next] = event.allocations;
+            window.next = (window.next + 1) % kWindowSize;
+            window.filled = std::min(window.filled + 1, kWindowSize);
+            window.totalCount++;
+
+            ExportEvent exportEvent;
+            exportEvent.event = event;
+            exportEvent.threadIndex = buffer->getThreadIndex();
+            _exportEvents.push_back(exportEvent);
+        }
+    }
+
+    // 泬ʱɵһ룬ⳤʱڴ
+    if (_exportEvents.size() > kMaxExportEvents) {
+        _exportEvents.erase(_exportEvents.begin(), _exportEvents.begin() + kMaxExportEvents / 2);
+    }
+}
+
+std::vector<TraceScopeSummary> TraceProfiler::getSummaries() const {
+    std::vector<TraceScopeSummary> result;
+    std::vector<float> sorted;
+    sorted.reserve(kWindowSize);
+
+    for (const auto& entry : _windows) {
+        const ScopeWindow& window = entry.second;
+        sorted.assign(window.samplesMs, window.samplesMs + window.filled);
+        std::sort(sorted.begin(), sorted.end());
+
+        TraceScopeSummary summary;
+        summary.name = entry.first;
+        summary.totalCount = window.totalCount;
+        summary.p50 = percentileOf(sorted, 0.50f);
+        summary.p95 = percentileOf(sorted, 0.95f);
+        summary.p99 = percentileOf(sorted, 0.99f);
+        summary.allocMax = 0;
+        for (size_t i = 0; i < window.filled; i++) {
+            summary.allocMax = std::max(summary.allocMax, window.allocSamples[i]);
+        }
+        result.push_back(summary);
+    }
+
+    std::sort(result.begin(), result.end(), [](const TraceScopeSummary& a, const TraceScopeSummary& b) {
+        return a.p95 > b.p95;
+    });
+    return result;
+}
+
+bool TraceProfiler::exportChromeTrace(const std::string& path) {
+    collect();
+
+    FILE* fp = fopen(path.c_str(), "wb");
+    if (!fp) return false;
+
+    fputs("{\"traceEvents\":[\n", fp);
+    for (size_t i = 0; i < _exportEvents.size(); ++i) {
+        const ExportEvent& e = _exportEvents[i];
+        fputs("{\"name\":\"", fp);
+        writeEscaped(fp, e.event.name);
+        fprintf(fp, "\",\"cat\":\"cardmatch\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d,"
+                    "\"args\":{\"allocs\":%u}}%s\n",
+                e.event.startNs / 1000.0, e.event.durationNs / 1000.0, e.threadIndex, e.event.allocations,
+                (i + 1 < _exportEvents.size()) ? "," : "");
+    }
+    fputs("],\"displayTimeUnit\":\"ms\"}\n", fp);
+
+    fclose(fp);
+    return true;
+}
+
+void TraceProfiler::reset() {
+    collect();
+    std::lock_guard<std::mutex> lock(_registryMutex);
+    _windows.clear();
+    _exportEvents.clear();
+}
+
+#endif // CM_ENABLE_TRACE
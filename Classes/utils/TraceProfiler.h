@@ -0,0 +1,208 @@
+// --------------------------------------------------------
+// ļ: Classes/utils/TraceProfiler.h
+// --------------------------------------------------------
+#ifndef __TRACE_PROFILER_H__
+#define __TRACE_PROFILER_H__
+
+#include "utils/AllocationTracker.h"
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// ׷ٿأĬϽ Debug COCOS2D_DEBUG > 0ãRelease Ϊ
+#ifndef CM_ENABLE_TRACE
+#if defined(COCOS2D_DEBUG) && (COCOS2D_DEBUG > 0)
+#define CM_ENABLE_TRACE 1
+#else
+#define CM_ENABLE_TRACE 0
+#endif
+#endif
+
+#if CM_ENABLE_TRACE
+
+/**
+ * @struct TraceEvent
+ * @brief һʱԭʼ¼
+ */
+struct TraceEvent {
+    const char* name;       ///< ƣַ
+    uint64_t startNs;       ///< ʼʱ䣨Խ룩
+    uint64_t durationNs;    ///< ʱ䣨룩
+    uint32_t allocations;   ///< ڵǰ̵߳Ķѷδ÷ʱΪ 0
+};
+
+/**
+ * @class TraceThreadBuffer
+ * @brief ̵߳׷ٻ
+ *
+ * ߣ̣߳/ ߣTraceProfiler::collectĻζУ
+ * д·ڴ棻ʱ¼
+ */
+class TraceThreadBuffer {
+public:
+    static const uint32_t kCapacity = 4096;  ///< ζ 2 ݣ
+
+    explicit TraceThreadBuffer(int threadIndex);
+
+    /**
+     * @brief дһ¼̵߳ã
+     */
+    void push(const char* name, uint64_t startNs, uint64_t durationNs, uint32_t allocations);
+
+    /**
+     * @brief ȡд¼ռ̵߳ã
+     * @param out ¼б׷ӣ
+     */
+    void drain(std::vector<TraceEvent>& out);
+
+    int getThreadIndex() const { return _threadIndex; }
+    uint64_t getDroppedCount() const { return _dropped.load(std::memory_order_relaxed); }
+
+private:
+    TraceEvent _events[kCapacity];
+    std::atomic<uint32_t> _head;      ///< дָ룬޸
+    std::atomic<uint32_t> _tail;      ///< ָ룬޸
+    std::atomic<uint64_t> _dropped;   ///< 򻺳¼
+    int _threadIndex;
+};
+
+/**
+ * @struct TraceScopeSummary
+ * @brief Ĺͳƽλ룩
+ */
+struct TraceScopeSummary {
+    std::string name;
+    uint64_t totalCount;   ///< ۼƵô
+    float p50;
+    float p95;
+    float p99;
+    uint32_t allocMax;     ///< ڵεõ
+};
+
+/**
+ * @class TraceProfiler
+ * @brief ȵ·ʱ׷¼ռ
+ *
+ * ְ
+ * - Ϊÿ̷߳¼
+ * - ڻܸ߳¼άÿ N κʱͷĹ
+ * -  p50/p95/p99 Chrome trace-event JSONchrome://tracing ֱӴ򿪣
+ *
+ * ʹó
+ * ͨ CM_TRACE_SCOPE ȵ㺯㣻
+ * TraceOverlayView ÿһʱ collect() ʾͳƽ
+ *
+ * ԭ
+ * - ·ֻһʱӶȡһλζд
+ * - ܡͳƺ͵ռ̣̣߳߳
+ * - Release ģ鲻
+ */
+class TraceProfiler {
+public:
+    static TraceProfiler* getInstance();
+
+    /**
+     * @brief ȡǰʱ䣨Խ룩
+     */
+    static uint64_t nowNs();
+
+    /**
+     * @brief ¼һ¼ǰ̵߳Ļ
+     * @param name ƣַ
+     * @param startNs ʼʱ
+     * @param durationNs ʱ
+     * @param allocations ڵĶѷ
+     */
+    void record(const char* name, uint64_t startNs, uint64_t durationNs, uint32_t allocations = 0);
+
+    /**
+     * @brief ̻߳е¼
+     * @details ¹ͳƲ׷ӵ棻Ӧ߳Ե
+     */
+    void collect();
+
+    /**
+     * @brief ȡͳժҪ
+     * @return  p95 ӴСժҪб
+     */
+    std::vector<TraceScopeSummary> getSummaries() const;
+
+    /**
+     * @brief  Chrome trace-event JSON
+     * @param path ļ·
+     * @return дɹ true
+     */
+    bool exportChromeTrace(const std::string& path);
+
+    /**
+     * @brief ͳ뵼
+     */
+    void reset();
+
+private:
+    static const size_t kWindowSize = 256;          ///< ÿ
+    static const size_t kMaxExportEvents = 200000;  ///< ޣ¼
+
+    struct ScopeWindow {
+        float samplesMs[kWindowSize];
+        uint32_t allocSamples[kWindowSize];
+        size_t next;
+        size_t filled;
+        uint64_t totalCount;
+    };
+
+    struct ExportEvent {
+        TraceEvent event;
+        int threadIndex;
+    };
+
+    TraceProfiler();
+
+    TraceThreadBuffer* getThreadBuffer();
+
+    std::mutex _registryMutex;                                  ///< ߳״עʱʹ
+    std::vector<std::unique_ptr<TraceThreadBuffer>> _buffers;
+    std::map<std::string, ScopeWindow> _windows;
+    std::vector<ExportEvent> _exportEvents;
+    std::vector<TraceEvent> _scratch;
+};
+
+/**
+ * @class TraceScope
+ * @brief RAII ʱʱдһ׷¼ڵĶѷ
+ */
+class TraceScope {
+public:
+    explicit TraceScope(const char* name)
+        : _name(name), _startNs(TraceProfiler::nowNs()) {}
+
+    ~TraceScope() {
+        // ȡд¼¼״ע̻߳ķ䲻
+        uint32_t allocations = (uint32_t)_allocations.getCount();
+        TraceProfiler::getInstance()->record(_name, _startNs, TraceProfiler::nowNs() - _startNs, allocations);
+    }
+
+private:
+    TraceScope(const TraceScope&);
+    TraceScope& operator=(const TraceScope&);
+
+    const char* _name;
+    uint64_t _startNs;
+    AllocationScope _allocations;
+};
+
+#define CM_TRACE_CONCAT_INNER(a, b) a##b
+#define CM_TRACE_CONCAT(a, b) CM_TRACE_CONCAT_INNER(a, b)
+#define CM_TRACE_SCOPE(name) TraceScope CM_TRACE_CONCAT(_cmTraceScope, __LINE__)(name)
+
+#else
+
+#define CM_TRACE_SCOPE(name) do {} while (0)
+
+#endif // CM_ENABLE_TRACE
+
+#endif // __TRACE_PROFILER_H__
@@ -3,11 +3,14 @@
 // --------------------------------------------------------
 #include "CardView.h"
 #include "utils/CardHelper.h"
+#include "utils/AssetBuckets.h"
+#include "managers/TextureResidency.h"
 
 USING_NS_CC;
 
 CardView::CardView()
-    : _cardBase(nullptr), _suitSprite(nullptr), _numberTop(nullptr), _numberBottom(nullptr), _cardModel(nullptr), _onClickCallback(nullptr)
+    : _cardBase(nullptr), _suitSprite(nullptr), _numberTop(nullptr), _numberBottom(nullptr), _cardModel(nullptr), _isFrontShown(false)
+    , _shownSuit(CST_NONE), _shownFace(CFT_NONE), _baseScale(kCardViewScale)
 {
 }
 
@@ -31,96 +34,133 @@ bool CardView::initWithCardModel(CardModel* cardModel) {
     CC_SAFE_RELEASE(_cardModel);
     _cardModel = cardModel;
     CC_SAFE_RETAIN(_cardModel);
+    // Կ ID Ϊڵ tag¼ķݴ˶λͼ
+    if (_cardModel) this->setTag(_cardModel->getId());
 
+    setupCardBase();
+
+    // ɫ
+    if (_cardModel) {
+        setCardFace(_cardModel->getSuit(), _cardModel->getFace());
+    }
+
+    this->flip(_cardModel ? _cardModel->isFaceUp() : false);
+
+    // עᴥϷ GameView Ĵ·ͳһַ
+    return true;
+}
+
+void CardView::bindCardModel(CardModel* cardModel) {
+    if (cardModel != _cardModel) {
+        CC_SAFE_RETAIN(cardModel);
+        CC_SAFE_RELEASE(_cardModel);
+        _cardModel = cardModel;
+    }
+    this->setTag(_cardModel ? _cardModel->getId() : Node::INVALID_TAG);
+    if (_cardModel) {
+        setCardFace(_cardModel->getSuit(), _cardModel->getFace());
+    }
+    setPressed(false);
+    this->flip(_cardModel ? _cardModel->isFaceUp() : false);
+}
+
+CardView* CardView::createDisplayCard() {
+    CardView* view = new (std::nothrow) CardView();
+    if (view && view->initDisplayCard()) {
+        view->autorelease();
+        return view;
+    }
+    CC_SAFE_DELETE(view);
+    return nullptr;
+}
+
+bool CardView::initDisplayCard() {
+    if (!Node::init()) return false;
+
+    setupCardBase();
+    this->flip(true);
+    return true;
+}
+
+void CardView::setupCardBase() {
     this->setAnchorPoint(Vec2(0.5f, 0.5f));
     this->setIgnoreAnchorPointForPosition(false);
 
     std::string bgPath = CardHelper::getCardBasePath();
-    _cardBase = Sprite::create(bgPath);
-    if (!_cardBase) {
+    _cardBase = TextureResidency::getInstance()->createSprite(bgPath);
+    if (_cardBase) {
+        // λѰʾߴԤţԭʼԷŴ kCardViewScale 
+        _baseScale = AssetBuckets::getRuntimeScale(bgPath, kCardViewScale);
+    }
+    else {
         _cardBase = Sprite::create();
-        _cardBase->setTextureRect(Rect(0, 0, 150, 210));
+        _cardBase->setTextureRect(Rect(0, 0, kCardArtWidth, kCardArtHeight));
+        _baseScale = kCardViewScale;
     }
+    _cardBase->setScale(_baseScale);
 
-    // ޸ġͳһΪ 3.0 
-    float cardScale = 3.0f;
-    _cardBase->setScale(cardScale);
-
-    Size scaledSize = _cardBase->getContentSize() * cardScale;
+    Size scaledSize = _cardBase->getContentSize() * _baseScale;
     this->setContentSize(scaledSize);
 
     _cardBase->setPosition(scaledSize.width / 2, scaledSize.height / 2);
     this->addChild(_cardBase);
+}
 
-    // ɫ֣뱣ֲ䣩
-    if (_cardModel) {
-        std::string suitPath = CardHelper::getSuitImagePath(_cardModel->getSuit());
-        _suitSprite = Sprite::create(suitPath);
+void CardView::setCardFace(CardSuitType suit, CardFaceType face) {
+    if (suit == _shownSuit && face == _shownFace) return;
+
+    // ɫͼ꣺״δ飬ֻ֮滻 TextureResidency Ǽǲ棩
+    // ·ȡ CardHelper ľ̬л治ƴַ
+    const std::string& suitPath = CardHelper::getSuitImageKey(suit);
+    if (!_suitSprite) {
+        _suitSprite = TextureResidency::getInstance()->createSprite(suitPath);
         if (_suitSprite) {
             _suitSprite->setPosition(_cardBase->getContentSize().width / 2, _cardBase->getContentSize().height / 2);
-            float s = (_cardBase->getContentSize().width / 3.0f) / _suitSprite->getContentSize().width;
-            _suitSprite->setScale(s);
             _cardBase->addChild(_suitSprite, 1);
         }
+    }
+    else if (suit != _shownSuit) {
+        TextureResidency::getInstance()->setSpriteTexture(_suitSprite, suitPath);
+    }
+    if (_suitSprite) {
+        float s = (_cardBase->getContentSize().width / 3.0f) / _suitSprite->getContentSize().width;
+        _suitSprite->setScale(s);
+    }
 
-        bool isBlack = (_cardModel->getSuit() == CST_CLUBS || _cardModel->getSuit() == CST_SPADES);
+    bool isBlack = (suit == CST_CLUBS || suit == CST_SPADES);
 
-        std::string numPath = CardHelper::getNumberImagePath(_cardModel->getFace(), true, isBlack);
-        _numberTop = Sprite::create(numPath);
+    const std::string& numPath = CardHelper::getNumberImageKey(face, isBlack);
+    if (!_numberTop) {
+        _numberTop = TextureResidency::getInstance()->createSprite(numPath);
         if (_numberTop) {
             _numberTop->setPosition(_cardBase->getContentSize().width * 0.15f, _cardBase->getContentSize().height * 0.85f);
-            _numberTop->setScale(0.4f);
+            // ԵС 0.4 
+            _numberTop->setScale(AssetBuckets::getRuntimeScale(numPath, 0.4f * kCardViewScale) / _baseScale);
             _cardBase->addChild(_numberTop, 2);
         }
     }
+    else {
+        TextureResidency::getInstance()->setSpriteTexture(_numberTop, numPath);
+    }
 
-    this->flip(_cardModel ? _cardModel->isFaceUp() : false);
-
-    // 
-    auto listener = EventListenerTouchOneByOne::create();
-    listener->setSwallowTouches(true);
-    listener->onTouchBegan = CC_CALLBACK_2(CardView::onTouchBegan, this);
-    listener->onTouchEnded = CC_CALLBACK_2(CardView::onTouchEnded, this);
-    _eventDispatcher->addEventListenerWithSceneGraphPriority(listener, this);
-
-    return true;
-}
-
-void CardView::setOnClickCallback(const std::function<void(CardView*)>& callback) {
-    _onClickCallback = callback;
-}
-
-bool CardView::onTouchBegan(Touch* touch, Event* event) {
-    if (_cardModel && !_cardModel->isFaceUp()) return false;
-    if (!_cardBase) return false;
-
-    Vec2 locationInNode = this->convertTouchToNodeSpace(touch);
-    Size s = this->getContentSize();
-    Rect rect = Rect(0, 0, s.width, s.height);
+    _shownSuit = suit;
+    _shownFace = face;
 
-    if (rect.containsPoint(locationInNode)) {
-        // ޸С 2.85f׼ 3.0f  95%
-        _cardBase->setScale(2.85f);
-        return true;
-    }
-    return false;
+    // ½ľĬϿɼ뵱ǰһ
+    if (_suitSprite) _suitSprite->setVisible(_isFrontShown);
+    if (_numberTop) _numberTop->setVisible(_isFrontShown);
 }
 
-void CardView::onTouchEnded(Touch* touch, Event* event) {
-    // ޸ָ׼С 3.0f
-    _cardBase->setScale(3.0f);
-    if (_onClickCallback) {
-        _onClickCallback(this);
-    }
+void CardView::setPressed(bool pressed) {
+    // С׼ŵ 95%ɿָ
+    if (_cardBase) _cardBase->setScale(pressed ? _baseScale * 0.95f : _baseScale);
 }
 
 void CardView::flip(bool showFront) {
     if (_suitSprite) _suitSprite->setVisible(showFront);
     if (_numberTop) _numberTop->setVisible(showFront);
 
-    if (_cardModel) {
-        _cardModel->setFaceUp(showFront);
-    }
+    _isFrontShown = showFront;
 
     if (!showFront) {
         _cardBase->setColor(Color3B(200, 220, 255));
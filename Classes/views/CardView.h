@@ -11,15 +11,15 @@
  * ְ
  * - ſƵӾ֣ɫ
  * - Ƶķ涯Ч
- * - ƵĴ¼ͨص֪ͨϲ
+ * - ṩ״̬ʾЧ GameView Ĵ·ͳһַ
  * 
  * ʹó
- *  PlayFieldController  StackController 
- * Ϸƶʾ
+ *  GameView ͼط PlayFieldController  StackControllerϷʾƣ
+ * GameView ͨ createDisplayCard ƶгפõĿ
  * 
  * ԭ
  * - ֻͼʾҵ߼
- * - ͨصûݸ Controller
+ * - עᴥͼûмעῪ
  * -  CardModel ڻȡ
  */
 class CardView : public cocos2d::Node {
@@ -41,11 +41,40 @@ public:
      */
     bool initWithCardModel(CardModel* cardModel);
 
+    /**
+     * @brief ͼİһſƣͼظã
+     * @param cardModel µĿģ
+     * @details 滻еģ͡tag 棬ȡģ͵ǰֵЧ
+     */
+    void bindCardModel(CardModel* cardModel);
+
+    /**
+     * @brief ֻչʾĿͼ
+     * @return ԶͷŵĿͼָ룬ʧܷ nullptr
+     * @details  CardModelͨ setCardFace 棻
+     *          ڳƶѵҪڸõλ
+     */
+    static CardView* createDisplayCard();
+
+    /**
+     * @brief ʾĻɫ͵
+     * @param suit ɫ
+     * @param face 
+     * @details еĻɫ飬ֻ滻½ڵ
+     */
+    void setCardFace(CardSuitType suit, CardFaceType face);
+
     /**
      * @brief ת
      * @param showFront true=ʾ棨ʾɫfalse=ʾ
+     * @note ֻıʾ޸ CardModel ĳ
      */
     void flip(bool showFront);
+
+    /**
+     * @brief ǰǷʾ
+     */
+    bool isFrontShown() const { return _isFrontShown; }
     
     /**
      * @brief ÿλ
@@ -60,34 +89,32 @@ public:
     CardModel* getCardModel() const { return _cardModel; }
 
     /**
-     * @brief õص
-     * @param callback ʱĻصΪǰ CardView
+     * @brief ð״̬ʾЧ
+     * @param pressed true=£΢Сfalse=ָ
      */
-    void setOnClickCallback(const std::function<void(CardView*)>& callback);
+    void setPressed(bool pressed);
 
 private:
     /**
-     * @brief ʼ¼
-     * @param touch 
-     * @param event ¼
-     * @return Ƿô¼
+     * @brief ʼչʾÿͼ
+     * @return ʼɹ true
      */
-    bool onTouchBegan(cocos2d::Touch* touch, cocos2d::Event* event);
-    
+    bool initDisplayCard();
+
     /**
-     * @brief ¼
-     * @param touch 
-     * @param event ¼
+     * @brief Ƶýڵߴ
      */
-    void onTouchEnded(cocos2d::Touch* touch, cocos2d::Event* event);
+    void setupCardBase();
 
     cocos2d::Sprite* _cardBase;      ///< ƻ
     cocos2d::Sprite* _suitSprite;    ///< ɫͼ
     cocos2d::Sprite* _numberTop;     ///< Ϸĵʶ
     cocos2d::Sprite* _numberBottom;  ///< ·ĵʶԤ
     CardModel* _cardModel;           ///< ģ
-
-    std::function<void(CardView*)> _onClickCallback;  ///< ص
+    bool _isFrontShown;              ///< ǰʾĳ
+    CardSuitType _shownSuit;         ///< ǰʾĻɫ
+    CardFaceType _shownFace;         ///< ǰʾĵ
+    float _baseScale;                ///< ƵʱţʱС 5%
 };
 
 #endif
\ No newline at end of file
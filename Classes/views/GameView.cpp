@@ -3,10 +3,27 @@
 // --------------------------------------------------------
 #include "GameView.h"
 #include "utils/CardHelper.h"
+#include "utils/AssetBuckets.h"
+#include "managers/TextureResidency.h"
+#include "utils/Logger.h"
+#include "utils/StartupTimeline.h"
+#include "utils/TraceProfiler.h"
 #include "views/CardView.h"
+#include <algorithm>
+#include <cmath>
 
 USING_NS_CC;
 
+namespace {
+    const float kBottomPanelHeight = 580.0f;
+    const float kScrollLowerMargin = 420.0f;   ///< ʱһпľײľ
+    const float kScrollUpperMargin = 360.0f;   ///< һпľĻС
+    const float kDragThreshold = 20.0f;        ///< ƶ˾תΪ϶
+    const float kScrollSpeed = 8.0f;           ///< ٶȣÿ룩
+    const float kSyncScrollStep = kCardHeight * 0.25f;  ///< ˾֪ͨͬͼ
+    const float kIndexCellSize = 256.0f;
+}
+
 GameView* GameView::create() {
     GameView* view = new (std::nothrow) GameView();
     if (view && view->init()) {
@@ -20,39 +37,75 @@ GameView* GameView::create() {
 bool GameView::init() {
     if (!Layer::init()) return false;
 
-    // ΪС
-    setupBackground();
-    setupBottomPanel();
+    _eventBus = nullptr;
+    _presentationHolds = 0;
+    _pressedCardId = -1;
+    _staticLayerSource = nullptr;
+    _staticLayerTexture = nullptr;
+    _isStaticLayerBaked = true;
+    _activityListener = nullptr;
+    _activeTouches = 0;
+    _scrollEnabled = false;
+    _scrollY = 0.0f;
+    _scrollTarget = 0.0f;
+    _minScroll = 0.0f;
+    _maxScroll = 0.0f;
+    _syncedScrollY = 0.0f;
+    _isDragging = false;
+    _dragStartY = 0.0f;
+    _dragStartScroll = 0.0f;
+    _playFieldChanged = false;
+    _undoBtnNode = nullptr;
+    _isUndoEnabled = true;
+    _isDeferredSetupDone = false;
+    for (int i = 0; i < kStackFanSize; i++) {
+        _stackCardViews[i] = nullptr;
+    }
+
+    // ΪС֡ҪĲ completeDeferredSetup д
+    rebuildStaticLayer();
     setupPlayField();
     setupStackArea();
     setupStockPile();
-    setupUndoButton();
+    setupActivityListener();
 
+    this->scheduleUpdate();
+    StartupTimeline::mark("GameView::init");
     return true;
 }
 
+void GameView::completeDeferredSetup() {
+    if (_isDeferredSetupDone) return;
+    _isDeferredSetupDone = true;
+
+    setupUndoButton();
+    setupStaticLayerListeners();
+}
+
 // ===================== ˽гʼ =====================
 
-void GameView::setupBackground() {
+void GameView::setupBackground(Node* layer) {
     auto director = Director::getInstance();
     Size visibleSize = director->getVisibleSize();
     Vec2 origin = director->getVisibleOrigin();
 
-    auto bg = Sprite::create("kitty.jpg");
+    auto bg = TextureResidency::getInstance()->createSprite("kitty.jpg");
     if (bg) {
         bg->setPosition(origin.x + visibleSize.width / 2, origin.y + visibleSize.height / 2);
+        // λѲó 1080 20:9 ĳߴ磬ĻΪ 1ֻвõ±ߣ
+        // ԭʼߵĻ԰ǿŴ
         float sx = visibleSize.width / bg->getContentSize().width;
         float sy = visibleSize.height / bg->getContentSize().height;
         bg->setScale(std::max(sx, sy));
-        this->addChild(bg, -10);
+        layer->addChild(bg, -10);
     }
     else {
-        auto layer = LayerColor::create(Color4B(255, 240, 245, 255));
-        this->addChild(layer, -10);
+        auto colorLayer = LayerColor::create(Color4B(255, 240, 245, 255));
+        layer->addChild(colorLayer, -10);
     }
 }
 
-void GameView::setupBottomPanel() {
+void GameView::setupBottomPanel(Node* layer) {
     auto director = Director::getInstance();
     Size visibleSize = director->getVisibleSize();
     Vec2 origin = director->getVisibleOrigin();
@@ -61,12 +114,27 @@ void GameView::setupBottomPanel() {
     float bottomHeight = 580.0f;
     auto bottomPanel = LayerColor::create(Color4B(255, 255, 255, 180), visibleSize.width, bottomHeight);
     bottomPanel->setPosition(origin.x, origin.y);
-    this->addChild(bottomPanel, 0);
+    layer->addChild(bottomPanel, 0);
 
     // ָ
     auto line = LayerColor::create(Color4B(200, 200, 200, 255), visibleSize.width, 2);
     line->setPosition(origin.x, origin.y + bottomHeight);
-    this->addChild(line, 1);
+    layer->addChild(line, 1);
+}
+
+void GameView::setupStackBase(Node* layer) {
+    auto director = Director::getInstance();
+    Size visibleSize = director->getVisibleSize();
+    Vec2 origin = director->getVisibleOrigin();
+
+    // Ƶ setupStackArea еĵƶѽڵͬһλ
+    auto stackBase = Sprite::create();
+    stackBase->setTextureRect(Rect(0, 0, kCardArtWidth, kCardArtHeight));
+    stackBase->setColor(Color3B::BLACK);
+    stackBase->setOpacity(15);
+    stackBase->setScale(kCardViewScale);
+    stackBase->setPosition(Vec2(origin.x + visibleSize.width / 2.0f, origin.y + kBottomPanelHeight / 2.0f));
+    layer->addChild(stackBase, 5);
 }
 
 void GameView::setupPlayField() {
@@ -76,6 +144,22 @@ void GameView::setupPlayField() {
     _playFieldLayer = Node::create();
     _playFieldLayer->setPosition(origin);
     this->addChild(_playFieldLayer, 10);
+
+    // 񸲸ɼ򣬵Ԫ߳ԼΪƿ
+    Size visibleSize = director->getVisibleSize();
+    _cardIndex.reset(Rect(0, 0, visibleSize.width, visibleSize.height), kIndexCellSize);
+
+    // ϷΨһĴ
+    auto listener = EventListenerTouchOneByOne::create();
+    listener->setSwallowTouches(true);
+    listener->onTouchBegan = CC_CALLBACK_2(GameView::onPlayFieldTouchBegan, this);
+    listener->onTouchMoved = CC_CALLBACK_2(GameView::onPlayFieldTouchMoved, this);
+    listener->onTouchEnded = CC_CALLBACK_2(GameView::onPlayFieldTouchEnded, this);
+    listener->onTouchCancelled = [this](Touch*, Event*) {
+        this->_isDragging = false;
+        this->releasePressedCard();
+    };
+    _eventDispatcher->addEventListenerWithSceneGraphPriority(listener, _playFieldLayer);
 }
 
 void GameView::setupStackArea() {
@@ -92,13 +176,15 @@ void GameView::setupStackArea() {
     _stackNode->setPosition(Vec2(centerX, bottomCenterY));
     this->addChild(_stackNode, 5);
 
-    // Ƶ
-    auto stackBase = Sprite::create();
-    stackBase->setTextureRect(Rect(0, 0, 150, 210));
-    stackBase->setColor(Color3B::BLACK);
-    stackBase->setOpacity(15);
-    stackBase->setScale(3.0f);  
-    _stackNode->addChild(stackBase, -1);
+    // ·Ƴפδʱֻ滻
+    for (int i = 0; i < kStackFanSize; i++) {
+        auto cardView = CardView::createDisplayCard();
+        cardView->setPosition(Vec2(-50.0f * i, 0.0f));
+        cardView->setRotation(-4.0f * i);
+        cardView->setVisible(false);
+        _stackNode->addChild(cardView, kStackFanSize - i);
+        _stackCardViews[i] = cardView;
+    }
 }
 
 void GameView::setupStockPile() {
@@ -124,13 +210,16 @@ void GameView::createStockPileSprites() {
 
     // ƱѵЧ
     for (int i = 0; i < 5; i++) {
-        auto sp = Sprite::create(CardHelper::getCardBasePath());
-        if (!sp) { 
-            sp = Sprite::create(); 
-            sp->setTextureRect(Rect(0, 0, 150, 210)); 
+        std::string basePath = CardHelper::getCardBasePath();
+        auto sp = TextureResidency::getInstance()->createSprite(basePath);
+        if (sp) {
+            sp->setScale(AssetBuckets::getRuntimeScale(basePath, kCardViewScale));
+        }
+        else {
+            sp = Sprite::create();
+            sp->setTextureRect(Rect(0, 0, kCardArtWidth, kCardArtHeight));
+            sp->setScale(kCardViewScale);
         }
-
-        sp->setScale(3.0f); 
         sp->setPosition(Vec2(i * 10.0f, 0));
 
         if (i == 4) {
@@ -160,7 +249,7 @@ bool GameView::onStockTouchBegan(cocos2d::Touch* t, cocos2d::Event* e) {
     Vec2 loc = _stockPileNode->convertToNodeSpace(t->getLocation());
     Rect bounds = calculateStockTouchBounds();
 
-    CCLOG("Stock touch at: (%.1f, %.1f), bounds: (%.1f, %.1f, %.1f, %.1f)", 
+    CM_LOG_TRACE(LC_INPUT, "Stock touch at: (%.1f, %.1f), bounds: (%.1f, %.1f, %.1f, %.1f)", 
           loc.x, loc.y, bounds.origin.x, bounds.origin.y, 
           bounds.size.width, bounds.size.height);
 
@@ -174,16 +263,14 @@ bool GameView::onStockTouchBegan(cocos2d::Touch* t, cocos2d::Event* e) {
 void GameView::onStockTouchEnded(cocos2d::Touch* t, cocos2d::Event* e) {
     _stockPileNode->runAction(ScaleTo::create(0.1f, 1.0f));
     if (_stockCallback) {
-        CCLOG("Stock callback triggered!");
+        CM_LOG_TRACE(LC_INPUT, "Stock callback triggered!");
         _stockCallback();
     } else {
-        CCLOG("Stock callback is NULL!");
+        CM_LOG_WARN(LC_INPUT, "Stock callback is NULL!");
     }
 }
 
 cocos2d::Rect GameView::calculateStockTouchBounds() const {
-    const float kCardWidth = 150.0f * 3.0f;
-    const float kCardHeight = 210.0f * 3.0f;
     const float kTotalWidth = kCardWidth + 4 * 10.0f;
     
     return Rect(-kCardWidth / 2.0f, -kCardHeight / 2.0f, kTotalWidth, kCardHeight);
@@ -242,6 +329,117 @@ void GameView::setupUndoButton() {
         if (_undoCallback) _undoCallback();
     };
     _eventDispatcher->addEventListenerWithSceneGraphPriority(undoListener, btnBg);
+    setUndoButtonEnabled(_isUndoEnabled);
+}
+
+void GameView::setupActivityListener() {
+    // ̶ȼгͼյûֻȫ֡
+    auto listener = EventListenerTouchOneByOne::create();
+    listener->setSwallowTouches(false);
+    listener->onTouchBegan = [this](Touch*, Event*) {
+        this->_activeTouches++;
+        this->_frameGovernor.wake();
+        return true;
+    };
+    auto onTouchFinished = [this](Touch*, Event*) {
+        if (this->_activeTouches > 0) this->_activeTouches--;
+        this->_frameGovernor.wake();
+    };
+    listener->onTouchEnded = onTouchFinished;
+    listener->onTouchCancelled = onTouchFinished;
+    _eventDispatcher->addEventListenerWithFixedPriority(listener, -1);
+    _activityListener = listener;
+}
+
+// ===================== ̬ϳ =====================
+
+void GameView::rebuildStaticLayer() {
+    if (_staticLayerSource) {
+        _staticLayerSource->removeFromParent();
+        _staticLayerSource->release();
+    }
+    _staticLayerSource = Node::create();
+    _staticLayerSource->retain();
+    setupBackground(_staticLayerSource);
+    setupBottomPanel(_staticLayerSource);
+    setupStackBase(_staticLayerSource);
+
+    if (_staticLayerTexture) {
+        _staticLayerTexture->removeFromParent();
+        _staticLayerTexture = nullptr;
+    }
+    if (_isStaticLayerBaked) {
+        bakeStaticLayer();
+    }
+    else {
+        this->addChild(_staticLayerSource, -10);
+    }
+}
+
+void GameView::bakeStaticLayer() {
+    CM_TRACE_SCOPE("GameView::bakeStaticLayer");
+    auto director = Director::getInstance();
+    Size visibleSize = director->getVisibleSize();
+    Vec2 origin = director->getVisibleOrigin();
+
+    if (_staticLayerTexture) {
+        _staticLayerTexture->removeFromParent();
+        _staticLayerTexture = nullptr;
+    }
+
+    auto texture = RenderTexture::create((int)visibleSize.width, (int)visibleSize.height);
+    if (!texture) {
+        CM_LOG_WARN(LC_RENDER, "Static layer bake failed, drawing nodes directly");
+        _isStaticLayerBaked = false;
+        this->addChild(_staticLayerSource, -10);
+        return;
+    }
+
+    // Դڵ㰴 GameView 겼֣ʱƽƵԭ㣻
+    // ڱ֡ȾʱִУԴڵ _staticLayerSource һֱ
+    _staticLayerSource->setPosition(-origin);
+    texture->beginWithClear(0, 0, 0, 0);
+    _staticLayerSource->visit();
+    texture->end();
+    _staticLayerSource->setPosition(Vec2::ZERO);
+
+    texture->setPosition(origin.x + visibleSize.width / 2.0f, origin.y + visibleSize.height / 2.0f);
+    this->addChild(texture, -10);
+    _staticLayerTexture = texture;
+
+    // ϳǰÿ֡ڵ㸲ǵһ飬ϳɺֻһȫı
+    float screenArea = visibleSize.width * visibleSize.height;
+    float coveredArea = 0.0f;
+    for (auto child : _staticLayerSource->getChildren()) {
+        Rect box = child->getBoundingBox();
+        float width = std::min(box.getMaxX(), origin.x + visibleSize.width) - std::max(box.getMinX(), origin.x);
+        float height = std::min(box.getMaxY(), origin.y + visibleSize.height) - std::max(box.getMinY(), origin.y);
+        if (width > 0.0f && height > 0.0f) coveredArea += width * height;
+    }
+    CM_LOG_INFO(LC_RENDER, "Static layer baked: %d nodes -> 1 quad, fill %.2f -> 1.00 screens",
+          (int)_staticLayerSource->getChildrenCount(), coveredArea / screenArea);
+}
+
+void GameView::setupStaticLayerListeners() {
+#if (CC_TARGET_PLATFORM == CC_PLATFORM_WIN32) || (CC_TARGET_PLATFORM == CC_PLATFORM_MAC) || (CC_TARGET_PLATFORM == CC_PLATFORM_LINUX)
+    // ڳߴ仯ɼ֮仯³ߴ²ֲϳ
+    auto resized = EventListenerCustom::create(GLViewImpl::EVENT_WINDOW_RESIZED, [this](EventCustom*) {
+        this->rebuildStaticLayer();
+    });
+    _eventDispatcher->addEventListenerWithSceneGraphPriority(resized, this);
+#endif
+
+    // Android лǰ̨ʱȾĿؽݶʧҪºϳ
+    auto recreated = EventListenerCustom::create(EVENT_RENDERER_RECREATED, [this](EventCustom*) {
+        if (this->_isStaticLayerBaked) this->bakeStaticLayer();
+    });
+    _eventDispatcher->addEventListenerWithSceneGraphPriority(recreated, this);
+}
+
+void GameView::setStaticLayerBaked(bool baked) {
+    if (baked == _isStaticLayerBaked) return;
+    _isStaticLayerBaked = baked;
+    rebuildStaticLayer();
 }
 
 // ===================== ӿں =====================
@@ -279,27 +477,313 @@ void GameView::setUndoCallback(const std::function<void()>& cb) { _undoCallback
 void GameView::setStockCallback(const std::function<void()>& cb) { _stockCallback = cb; }
 void GameView::setRestartCallback(const std::function<void()>& cb) { _restartCallback = cb; }
 
-void GameView::updateStackView(CardModel* topCard) {
-    _stackNode->removeAllChildren();
+void GameView::updateStackView(const StackCardFace* cards, int count) {
+    for (int i = 0; i < kStackFanSize; i++) {
+        CardView* cardView = _stackCardViews[i];
+        if (i < count) {
+            cardView->setCardFace(cards[i].suit, cards[i].face);
+            cardView->setVisible(true);
+        }
+        else {
+            cardView->setVisible(false);
+        }
+    }
+}
+
+// ===================== Ϸ· =====================
 
-    // ص
-    auto stackBase = Sprite::create();
-    stackBase->setTextureRect(Rect(0, 0, 150, 210));
-    stackBase->setColor(Color3B::BLACK);
-    stackBase->setOpacity(15);
-    stackBase->setScale(3.0f);  
-    _stackNode->addChild(stackBase, -1);
+void GameView::setCardTapCallback(const std::function<void(int)>& cb) { _cardTapCallback = cb; }
+
+void GameView::registerPlayFieldCard(CardView* cardView) {
+    if (!cardView) return;
+    _cardIndex.insert(cardView->getTag(), cardView->getBoundingBox(),
+                      cardView->getLocalZOrder(), cardView->isFrontShown());
+}
+
+void GameView::unregisterPlayFieldCard(int cardId) {
+    _cardIndex.remove(cardId);
+}
+
+void GameView::clearPlayFieldCards() {
+    _cardIndex.clear();
+    _pressedCardId = -1;
+}
+
+bool GameView::onPlayFieldTouchBegan(Touch* t, Event* e) {
+    // ڵײʱƺͳť
+    Vec2 screenPoint = this->convertToNodeSpace(t->getLocation());
+    if (_scrollEnabled && screenPoint.y < kBottomPanelHeight) return false;
+
+    _isDragging = false;
+    _dragStartY = t->getLocation().y;
+    _dragStartScroll = _scrollY;
+
+    Vec2 point = _playFieldLayer->convertToNodeSpace(t->getLocation());
+    int cardId = _cardIndex.hitTest(point);
+    auto cardView = cardId >= 0 ? dynamic_cast<CardView*>(_playFieldLayer->getChildByTag(cardId)) : nullptr;
+    if (!cardView) return _scrollEnabled;
 
-    if (topCard) {
-        auto cardView = CardView::createWithCardModel(topCard);
-        cardView->setPosition(Vec2::ZERO);
-        cardView->flip(true);
-        cardView->setOnClickCallback(nullptr);
-        _stackNode->addChild(cardView);
+    cardView->setPressed(true);
+    _pressedCardId = cardId;
+    return true;
+}
+
+void GameView::onPlayFieldTouchMoved(Touch* t, Event* e) {
+    if (!_scrollEnabled) return;
+
+    float dy = t->getLocation().y - _dragStartY;
+    if (!_isDragging) {
+        // Ʒڼ䲻յǰʱͼλü
+        if (std::fabs(dy) < kDragThreshold || _presentationHolds > 0) return;
+        _isDragging = true;
+        releasePressedCard();
+    }
+
+    // ݸָƶָʱͼƣλüС
+    _scrollTarget = clampScroll(_dragStartScroll - dy);
+    _scrollY = _scrollTarget;
+    applyScroll();
+}
+
+void GameView::onPlayFieldTouchEnded(Touch* t, Event* e) {
+    if (_isDragging) {
+        _isDragging = false;
+        return;
+    }
+
+    int cardId = releasePressedCard();
+    if (cardId >= 0 && _cardTapCallback) {
+        _cardTapCallback(cardId);
+    }
+}
+
+int GameView::releasePressedCard() {
+    int cardId = _pressedCardId;
+    _pressedCardId = -1;
+    if (cardId < 0) return -1;
+
+    auto cardView = dynamic_cast<CardView*>(_playFieldLayer->getChildByTag(cardId));
+    if (cardView) cardView->setPressed(false);
+    return cardId;
+}
+
+// ===================== ģ¼ =====================
+
+void GameView::update(float dt) {
+    // н¼ͷűͬһ֡ڼɴѹ¼
+    _tweens.update(dt);
+    if (_presentationHolds == 0) {
+        flushEvents();
+        updateScroll(dt);
+    }
+    _frameGovernor.update(dt, isPresentationBusy());
+}
+
+bool GameView::isPresentationBusy() const {
+    return _tweens.getActiveCount() > 0
+        || _presentationHolds > 0
+        || _activeTouches > 0
+        || _isDragging
+        || _scrollY != _scrollTarget
+        || Director::getInstance()->getActionManager()->getNumberOfRunningActions() > 0;
+}
+
+void GameView::flushEvents() {
+    if (!_eventBus) return;
+
+    GameEvent event;
+    while (_eventBus->poll(event)) {
+        handleEvent(event);
+    }
+
+    // ¼ͳһͬͼ¼Ϸ
+    if (_playFieldChanged) {
+        _playFieldChanged = false;
+        if (_playFieldSyncCallback) _playFieldSyncCallback(true);
+    }
+}
+
+void GameView::beginPresentationHold() {
+    _presentationHolds++;
+}
+
+void GameView::endPresentationHold() {
+    if (_presentationHolds > 0) _presentationHolds--;
+}
+
+void GameView::handleEvent(const GameEvent& event) {
+    switch (event.type) {
+    case GET_CARD_REMOVED: {
+        // ˷жĿͼɶգֻ
+        _cardIndex.remove(event.cardId);
+        auto cardView = dynamic_cast<CardView*>(_playFieldLayer->getChildByTag(event.cardId));
+        if (cardView) recycleCardView(cardView);
+        _playFieldChanged = true;
+        break;
+    }
+    case GET_CARD_ADDED:
+        _playFieldChanged = true;
+        break;
+    case GET_CARD_REVEALED:
+    case GET_CARD_COVERED: {
+        bool revealed = (event.type == GET_CARD_REVEALED);
+        auto cardView = dynamic_cast<CardView*>(_playFieldLayer->getChildByTag(event.cardId));
+        if (cardView) cardView->flip(revealed);
+        _cardIndex.setActive(event.cardId, revealed);
+        break;
+    }
+    case GET_TOP_CHANGED: {
+        StackCardFace cards[kStackFanSize];
+        int count = 0;
+        if (event.cardId >= 0) {
+            cards[count].suit = (CardSuitType)event.suit;
+            cards[count].face = (CardFaceType)event.face;
+            count++;
+            for (int i = 0; i < event.value && count < kStackFanSize; i++) {
+                cards[count].suit = (CardSuitType)event.beneathSuit[i];
+                cards[count].face = (CardFaceType)event.beneathFace[i];
+                count++;
+            }
+        }
+        updateStackView(cards, count);
+        break;
+    }
+    case GET_STOCK_COUNT_CHANGED:
+        updateStockView(event.value);
+        break;
+    case GET_GAME_OVER:
+        showGameOverUI(event.value != 0);
+        break;
+    }
+}
+
+// ===================== ͼ =====================
+
+CardView* GameView::acquireCardView(CardModel* cardModel) {
+    if (_cardViewPool.empty()) {
+        return CardView::createWithCardModel(cardModel);
+    }
+
+    CardView* cardView = _cardViewPool.back();
+    cardView->retain();
+    cardView->autorelease();
+    _cardViewPool.popBack();
+
+    cardView->setRotation(0.0f);
+    cardView->setOpacity(255);
+    cardView->setVisible(true);
+    cardView->bindCardModel(cardModel);
+    return cardView;
+}
+
+void GameView::recycleCardView(CardView* cardView) {
+    if (!cardView) return;
+
+    _tweens.cancel(cardView);
+    if (cardView->getTag() == _pressedCardId) _pressedCardId = -1;
+    if (cardView->getCardModel()) _cardIndex.remove(cardView->getCardModel()->getId());
+
+    // ȷͼƳڵ㣬ͼ;ͷ
+    bool pooled = (int)_cardViewPool.size() < kMaxPooledCardViews && !_cardViewPool.contains(cardView);
+    if (pooled) _cardViewPool.pushBack(cardView);
+    cardView->removeFromParent();
+    if (pooled) cardView->bindCardModel(nullptr);
+}
+
+void GameView::setScrollEnabled(bool enabled) {
+    _scrollEnabled = enabled;
+    _isDragging = false;
+    if (!enabled) {
+        _scrollY = 0.0f;
+        _scrollTarget = 0.0f;
+        _minScroll = 0.0f;
+        _maxScroll = 0.0f;
+        applyScroll();
+    }
+}
+
+void GameView::setPlayFieldContentRange(float bottomY, float topY, bool follow) {
+    if (!_scrollEnabled) return;
+
+    float visibleHeight = Director::getInstance()->getVisibleSize().height;
+    _minScroll = bottomY - (kBottomPanelHeight + kScrollLowerMargin);
+    _maxScroll = std::max(_minScroll, topY - (visibleHeight - kScrollUpperMargin));
+
+    if (follow && !_isDragging) {
+        _scrollTarget = _minScroll;
+    }
+    _scrollTarget = clampScroll(_scrollTarget);
+}
+
+Rect GameView::getPlayFieldViewport() const {
+    Size visibleSize = Director::getInstance()->getVisibleSize();
+    float bottom = _scrollY + kBottomPanelHeight - kCardHeight * 1.5f;
+    float top = _scrollY + visibleSize.height + kCardHeight * 1.5f;
+    return Rect(-kCardWidth, bottom, visibleSize.width + kCardWidth * 2.0f, top - bottom);
+}
+
+void GameView::shiftPlayField(const Vec2& delta) {
+    for (auto node : _playFieldLayer->getChildren()) {
+        auto cardView = dynamic_cast<CardView*>(node);
+        if (!cardView) continue;
+
+        // ؾִ֮Уʱֻвƥ䶶ֱͣڿλ
+        _tweens.cancel(cardView);
+        CardModel* card = cardView->getCardModel();
+        cardView->setPosition(card && card->isInPlayField() ? card->getPosition() : cardView->getPosition() + delta);
+        if (card) cardView->setLocalZOrder(card->getLocalZOrder());
+    }
+
+    _scrollY += delta.y;
+    _scrollTarget += delta.y;
+    _minScroll += delta.y;
+    _maxScroll += delta.y;
+    _dragStartScroll += delta.y;
+    _syncedScrollY = _scrollY;
+
+    _cardIndex.clear();
+    _pressedCardId = -1;
+    applyScroll();
+}
+
+void GameView::setPlayFieldSyncCallback(const std::function<void(bool)>& cb) { _playFieldSyncCallback = cb; }
+
+float GameView::clampScroll(float scrollY) const {
+    return std::min(std::max(scrollY, _minScroll), _maxScroll);
+}
+
+void GameView::updateScroll(float dt) {
+    if (!_scrollEnabled || _isDragging || _scrollY == _scrollTarget) return;
+
+    float distance = _scrollTarget - _scrollY;
+    if (std::fabs(distance) < 0.5f) {
+        _scrollY = _scrollTarget;
+    }
+    else {
+        _scrollY += distance * std::min(1.0f, dt * kScrollSpeed);
+    }
+    applyScroll();
+}
+
+void GameView::applyScroll() {
+    Vec2 origin = Director::getInstance()->getVisibleOrigin();
+    _playFieldLayer->setPosition(origin.x, origin.y - _scrollY);
+
+    // ɼ򣬰Ԫƶÿ֡¹
+    float indexBottom = std::floor(_scrollY / kIndexCellSize) * kIndexCellSize;
+    _cardIndex.moveBounds(Vec2(0.0f, indexBottom));
+
+    if (std::fabs(_scrollY - _syncedScrollY) >= kSyncScrollStep || _scrollY == _scrollTarget) {
+        if (_scrollY != _syncedScrollY) {
+            _syncedScrollY = _scrollY;
+            if (_playFieldSyncCallback) _playFieldSyncCallback(false);
+        }
     }
 }
 
 void GameView::setUndoButtonEnabled(bool enabled) {
+    // ťδʱֻ¼״̬ʱ
+    _isUndoEnabled = enabled;
     if (_undoBtnNode) {
         _undoBtnNode->setOpacity(enabled ? 255 : 100);
     }
@@ -414,6 +898,10 @@ void GameView::playGameOverAnimation(cocos2d::LayerColor* mask) {
 }
 
 GameView::~GameView() {
-    // Cocos2d-x Զ child nodes
-    // ֶ
+    // Cocos2d-x Զ child nodesͼеͼ Vector ͷ
+    _tweens.cancelAll();
+    _cardViewPool.clear();
+    if (_activityListener) _eventDispatcher->removeEventListener(_activityListener);
+    CC_SAFE_RELEASE(_staticLayerSource);
+    _frameGovernor.setEnabled(false);
 }
\ No newline at end of file
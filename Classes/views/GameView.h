@@ -6,8 +6,22 @@
 
 #include "cocos2d.h"
 #include "models/CardModel.h"
+#include "managers/GameEventBus.h"
+#include "utils/CardSpatialIndex.h"
+#include "views/CardView.h"
+#include "managers/TweenManager.h"
+#include "managers/FrameRateGovernor.h"
 #include <functional>
 
+/**
+ * @struct StackCardFace
+ * @brief 出牌堆中一张卡牌的显示数据
+ */
+struct StackCardFace {
+    CardSuitType suit;  ///< 花色
+    CardFaceType face;  ///< 点数
+};
+
 /**
  * @class GameView
  * @brief 游戏主界面视图层
@@ -15,14 +29,23 @@
  * 职责：
  * - 管理所有UI元素的显示和布局
  * - 提供底牌/备用牌的位置查询接口
+ * - 游戏区只注册一个触摸监听，通过空间索引找到被点击的卡牌
  * - 通过回调接口与 Controller 交互
+ * - 持有卡牌移动的补间系统，每帧统一推进
+ * - 画面静止时通过 FrameRateGovernor 降低帧率，触摸或动画开始时恢复
+ * - 背景、底部操作区、分割线和底牌底座预先合成到一张 RenderTexture，每帧只绘制一个全屏四边形
+ * - 维护游戏区卡牌视图池；无尽模式下支持纵向滚动，可见范围变化时通知 Controller 同步视图
  * 
  * 设计原则：
  * - 不持有 Model 数据，只接收外部传入的数据进行显示
+ * - 模型变化通过 GameEventBus 订阅，每帧统一处理一次
  * - 所有用户交互通过回调转发给 Controller
  */
 class GameView : public cocos2d::Layer {
 public:
+    static const int kStackFanSize = 1 + GameEvent::kMaxBeneathCards;  ///< 出牌堆常驻显示的卡牌数（底牌 + 下方扇形）
+    static const int kMaxPooledCardViews = 48;                          ///< 视图池最多保留的卡牌视图数
+
     /**
      * @brief 创建 GameView 实例
      * @return 自动释放的 GameView 指针
@@ -31,12 +54,41 @@ public:
     bool init() override;
     ~GameView();
 
+    /**
+     * @brief 每帧处理事件总线中积压的模型事件
+     * @param dt 帧间隔
+     */
+    void update(float dt) override;
+
     /**
      * @brief 获取主牌区图层
      * @return 主牌区的 Node 节点
      */
     cocos2d::Node* getPlayFieldLayer() { return _playFieldLayer; }
 
+    /**
+     * @brief 获取卡牌移动的补间系统
+     * @details 补间不受表现锁限制，每帧在处理模型事件之前推进
+     */
+    TweenManager& getTweens() { return _tweens; }
+
+    /**
+     * @brief 启用或关闭按需渲染
+     * @details 启用后画面静止超过 FrameRateGovernor::kIdleDelay 秒时降到空闲帧率
+     */
+    void setRenderOnDemand(bool enabled) { _frameGovernor.setEnabled(enabled); }
+
+    /**
+     * @brief 设置静态层是否合成为一张纹理
+     * @param baked true=合成（默认），false=各节点单独绘制，用于对比合成前后的填充开销
+     */
+    void setStaticLayerBaked(bool baked);
+
+    /**
+     * @brief 最近一分钟的渲染统计
+     */
+    const RenderStats& getRenderStats() const { return _frameGovernor.getLastStats(); }
+
     /**
      * @brief 获取底牌堆的世界坐标
      * @return 底牌堆中心点的世界坐标
@@ -51,9 +103,11 @@ public:
 
     /**
      * @brief 更新底牌堆显示
-     * @param topCard 当前底牌，传 nullptr 表示清空
+     * @param cards 从底牌开始向下的卡牌显示数据，cards[0] 为底牌
+     * @param count 卡牌数量，0 表示清空；超过 kStackFanSize 的部分忽略
+     * @details 复用常驻的卡牌视图，只替换牌面和可见性，不创建或销毁节点
      */
-    void updateStackView(CardModel* topCard);
+    void updateStackView(const StackCardFace* cards, int count);
     
     /**
      * @brief 更新备用牌堆显示
@@ -61,6 +115,101 @@ public:
      */
     void updateStockView(int count);
 
+    /**
+     * @brief 设置订阅的事件总线
+     * @param eventBus 事件总线（不持有）
+     */
+    void setEventBus(GameEventBus* eventBus) { _eventBus = eventBus; }
+
+    /**
+     * @brief 立即处理所有积压的模型事件
+     * @details 不受表现锁限制；GameController 在执行下一条输入前调用，使视图追上模型
+     */
+    void flushEvents();
+
+    /**
+     * @brief 加一层表现锁
+     * @details 卡牌飞行期间持有，期间 update 不处理事件，
+     *          保证底牌、翻面和结算界面在卡牌落下后才刷新
+     */
+    void beginPresentationHold();
+
+    /**
+     * @brief 释放一层表现锁
+     */
+    void endPresentationHold();
+
+    /**
+     * @brief 设置游戏区卡牌点击回调
+     * @param callback 点击回调，参数为被点击的卡牌 ID
+     */
+    void setCardTapCallback(const std::function<void(int)>& callback);
+
+    /**
+     * @brief 把游戏区卡牌视图登记到点击索引
+     * @param cardView 已添加到游戏区图层、位于最终位置的卡牌视图
+     * @details 重复登记会更新位置、Z 序和可点击状态
+     */
+    void registerPlayFieldCard(CardView* cardView);
+
+    /**
+     * @brief 从点击索引中移除卡牌
+     * @param cardId 卡牌 ID
+     */
+    void unregisterPlayFieldCard(int cardId);
+
+    /**
+     * @brief 清空点击索引（重新渲染游戏区时调用）
+     */
+    void clearPlayFieldCards();
+
+    /**
+     * @brief 为卡牌取一个游戏区卡牌视图
+     * @param cardModel 卡牌模型
+     * @return 自动释放的卡牌视图（尚未加入任何父节点），优先复用视图池中的视图
+     */
+    CardView* acquireCardView(CardModel* cardModel);
+
+    /**
+     * @brief 回收游戏区卡牌视图
+     * @param cardView 不再显示的卡牌视图
+     * @details 取消视图上的补间，从点击索引和父节点移除，解除与模型的绑定；视图池未满时放入视图池
+     */
+    void recycleCardView(CardView* cardView);
+
+    /**
+     * @brief 启用或关闭游戏区纵向滚动（无尽模式）
+     */
+    void setScrollEnabled(bool enabled);
+
+    /**
+     * @brief 设置游戏区内容的纵向范围
+     * @param bottomY 最下面一张卡牌中心的 Y 坐标（游戏区坐标）
+     * @param topY 最上面一张卡牌中心的 Y 坐标
+     * @param follow true 时滚动到最下面一行（新卡牌落下后跟随），false 时只限制滚动范围
+     */
+    void setPlayFieldContentRange(float bottomY, float topY, bool follow);
+
+    /**
+     * @brief 获取需要创建卡牌视图的区域（游戏区坐标）
+     * @return 当前可见区域向上下各扩展一张牌高的矩形
+     */
+    cocos2d::Rect getPlayFieldViewport() const;
+
+    /**
+     * @brief 平移游戏区的所有卡牌视图和滚动位置（无尽模式坐标回卷）
+     * @param delta 位移，与模型的位移相同
+     * @details 画面保持不动；点击索引被清空，调用方随后重新登记卡牌视图
+     */
+    void shiftPlayField(const cocos2d::Vec2& delta);
+
+    /**
+     * @brief 设置游戏区视图同步回调
+     * @param callback 参数为 true 表示游戏区有卡牌增减（需要跟随滚动），false 表示只是滚动位置变化
+     * @details 在处理完一批模型事件、或滚动超过一定距离后调用
+     */
+    void setPlayFieldSyncCallback(const std::function<void(bool)>& callback);
+
     /**
      * @brief 设置撤销按钮回调
      * @param callback 点击撤销按钮时触发的回调函数
@@ -79,6 +228,12 @@ public:
      */
     void setRestartCallback(const std::function<void()>& callback);
     
+    /**
+     * @brief 创建延后初始化的部分：撤销按钮、窗口尺寸变化和渲染上下文重建监听
+     * @details 由 GameController 在首个可交互帧之后调用，缩短启动到首帧的时间；重复调用无效
+     */
+    void completeDeferredSetup();
+
     /**
      * @brief 设置撤销按钮启用状态
      * @param enabled true=启用，false=禁用（灰化显示）
@@ -94,12 +249,33 @@ public:
 private:
     // ===================== 初始化相关 =====================
     
-    void setupBackground();
-    void setupBottomPanel();
+    void setupBackground(cocos2d::Node* layer);
+    void setupBottomPanel(cocos2d::Node* layer);
+    void setupStackBase(cocos2d::Node* layer);
     void setupPlayField();
     void setupStackArea();
     void setupStockPile();
     void setupUndoButton();
+    void setupActivityListener();
+
+    // ===================== 静态层合成 =====================
+
+    /**
+     * @brief 重新创建静态层的源节点（背景、底部操作区、分割线、底牌底座）
+     * @details 源节点按当前可见区域布局，合成或直接挂到 GameView 上
+     */
+    void rebuildStaticLayer();
+
+    /**
+     * @brief 把静态层源节点绘制到 RenderTexture
+     * @details 只在创建、分辨率变化和渲染上下文重建时调用
+     */
+    void bakeStaticLayer();
+
+    /**
+     * @brief 监听窗口尺寸变化和渲染上下文重建，重新合成静态层
+     */
+    void setupStaticLayerListeners();
     
     // 备用牌堆初始化子函数
     void createStockPileSprites();
@@ -122,12 +298,60 @@ private:
      */
     void onStockTouchEnded(cocos2d::Touch* t, cocos2d::Event* e);
     
+    /**
+     * @brief 游戏区触摸开始：点击测试并显示按下效果
+     */
+    bool onPlayFieldTouchBegan(cocos2d::Touch* t, cocos2d::Event* e);
+
+    /**
+     * @brief 游戏区触摸移动：滚动启用时，移动超过阈值转为拖动滚动
+     */
+    void onPlayFieldTouchMoved(cocos2d::Touch* t, cocos2d::Event* e);
+
+    /**
+     * @brief 游戏区触摸结束：恢复按下效果并分发点击
+     */
+    void onPlayFieldTouchEnded(cocos2d::Touch* t, cocos2d::Event* e);
+
+    /**
+     * @brief 恢复按下卡牌的显示
+     * @return 按下的卡牌 ID，没有返回 -1
+     */
+    int releasePressedCard();
+
     /**
      * @brief 计算备用牌堆的触摸区域
      * @return 触摸区域矩形
      */
     cocos2d::Rect calculateStockTouchBounds() const;
     
+    /**
+     * @brief 画面是否仍在变化（补间、Action、滚动、表现锁或进行中的触摸）
+     */
+    bool isPresentationBusy() const;
+
+    /**
+     * @brief 向目标位置推进滚动动画
+     * @param dt 帧间隔
+     */
+    void updateScroll(float dt);
+
+    /**
+     * @brief 把滚动位置应用到游戏区图层，滚动足够远时通知 Controller 同步视图
+     */
+    void applyScroll();
+
+    /**
+     * @brief 把滚动位置限制在内容范围内
+     */
+    float clampScroll(float scrollY) const;
+
+    /**
+     * @brief 处理一条模型事件
+     * @param event 事件
+     */
+    void handleEvent(const GameEvent& event);
+
     // ===================== 游戏结束界面相关 =====================
     
     cocos2d::LayerColor* createGameOverMask();
@@ -138,15 +362,45 @@ private:
     // ===================== 成员变量 =====================
     
     cocos2d::Node* _playFieldLayer;           ///< 主牌区图层
+    cocos2d::Node* _staticLayerSource;        ///< 静态层源节点（持有；合成时不在场景中）
+    cocos2d::RenderTexture* _staticLayerTexture; ///< 合成后的静态层，未合成时为 nullptr
+    bool _isStaticLayerBaked;                 ///< 静态层是否合成为一张纹理
     cocos2d::Node* _stackNode;                ///< 底牌堆节点
+    CardView* _stackCardViews[kStackFanSize]; ///< 底牌堆常驻卡牌视图，[0] 为底牌
     cocos2d::Node* _stockPileNode;            ///< 备用牌堆节点
     cocos2d::Sprite* _stockSprite;            ///< 备用牌顶部精灵
     cocos2d::Label* _stockCountLabel;         ///< 备用牌数量标签
-    cocos2d::Node* _undoBtnNode;              ///< 撤销按钮节点
+    cocos2d::Node* _undoBtnNode;              ///< 撤销按钮节点，延后初始化前为 nullptr
+    bool _isUndoEnabled;                      ///< 撤销按钮的启用状态（按钮创建前也记录）
+    bool _isDeferredSetupDone;                ///< 是否已完成延后初始化
     
     std::function<void()> _undoCallback;      ///< 撤销按钮回调
     std::function<void()> _stockCallback;     ///< 备用牌点击回调
     std::function<void()> _restartCallback;   ///< 重新开始回调
+    std::function<void(int)> _cardTapCallback; ///< 游戏区卡牌点击回调
+
+    CardSpatialIndex _cardIndex;              ///< 游戏区卡牌点击索引
+    int _pressedCardId;                       ///< 当前按下的卡牌 ID，-1 表示无
+
+    GameEventBus* _eventBus;                  ///< 订阅的事件总线（不持有）
+    int _presentationHolds;                   ///< 表现锁计数
+
+    TweenManager _tweens;                     ///< 卡牌移动补间
+    FrameRateGovernor _frameGovernor;         ///< 按需渲染的帧率调节器
+    cocos2d::EventListener* _activityListener; ///< 唤醒帧率的全局触摸监听（固定优先级，需手动移除）
+    int _activeTouches;                       ///< 进行中的触摸数
+    cocos2d::Vector<CardView*> _cardViewPool; ///< 空闲的游戏区卡牌视图
+    std::function<void(bool)> _playFieldSyncCallback; ///< 游戏区视图同步回调
+    bool _scrollEnabled;                      ///< 是否启用纵向滚动
+    float _scrollY;                           ///< 当前滚动位置（游戏区图层下移的距离）
+    float _scrollTarget;                      ///< 滚动目标位置
+    float _minScroll;                         ///< 滚动下限
+    float _maxScroll;                         ///< 滚动上限
+    float _syncedScrollY;                     ///< 上次通知同步时的滚动位置
+    bool _isDragging;                         ///< 是否正在拖动滚动
+    float _dragStartY;                        ///< 拖动开始时触点的 Y 坐标
+    float _dragStartScroll;                   ///< 拖动开始时的滚动位置
+    bool _playFieldChanged;                   ///< 本批事件中游戏区是否有卡牌增减
 };
 
 #endif
\ No newline at end of file
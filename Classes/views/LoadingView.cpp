@@ -0,0 +1,56 @@
+// --------------------------------------------------------
+// ļ: Classes/views/LoadingView.cpp
+// --------------------------------------------------------
+#include "LoadingView.h"
+#include <cstdio>
+
+USING_NS_CC;
+
+namespace {
+    const float kBarWidth = 600.0f;   ///< 
+    const float kBarHeight = 16.0f;   ///< ߶
+}
+
+LoadingView* LoadingView::create() {
+    LoadingView* view = new (std::nothrow) LoadingView();
+    if (view && view->init()) {
+        view->autorelease();
+        return view;
+    }
+    CC_SAFE_DELETE(view);
+    return nullptr;
+}
+
+bool LoadingView::init() {
+    if (!Node::init()) return false;
+
+    auto director = Director::getInstance();
+    Size visibleSize = director->getVisibleSize();
+    Vec2 origin = director->getVisibleOrigin();
+    Vec2 center(origin.x + visibleSize.width / 2.0f, origin.y + visibleSize.height / 2.0f);
+
+    this->addChild(LayerColor::create(Color4B(255, 240, 245, 255)));
+
+    auto track = LayerColor::create(Color4B(200, 200, 200, 255), kBarWidth, kBarHeight);
+    track->setPosition(center.x - kBarWidth / 2.0f, center.y - kBarHeight / 2.0f);
+    this->addChild(track, 1);
+
+    _bar = LayerColor::create(Color4B(90, 160, 230, 255), 0.0f, kBarHeight);
+    _bar->setPosition(track->getPosition());
+    this->addChild(_bar, 2);
+
+    _label = Label::createWithSystemFont("Loading 0%", "Arial", 36);
+    _label->setTextColor(Color4B(80, 80, 80, 255));
+    _label->setPosition(center.x, center.y + 60.0f);
+    this->addChild(_label, 2);
+    return true;
+}
+
+void LoadingView::setProgress(int done, int total) {
+    float progress = total > 0 ? (float)done / (float)total : 1.0f;
+    _bar->changeWidth(kBarWidth * progress);
+
+    char text[32];
+    snprintf(text, sizeof(text), "Loading %d%%", (int)(progress * 100.0f + 0.5f));
+    _label->setString(text);
+}
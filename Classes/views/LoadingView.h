@@ -0,0 +1,39 @@
+// --------------------------------------------------------
+// ļ: Classes/views/LoadingView.h
+// --------------------------------------------------------
+#ifndef __LOADING_VIEW_H__
+#define __LOADING_VIEW_H__
+
+#include "cocos2d.h"
+
+/**
+ * @class LoadingView
+ * @brief ԤڼĽ
+ *
+ * ְ
+ * - ڴɫʾͰٷֱ
+ *
+ * ʹó
+ * GameController ԤʱӵԤɡGameView Ƴ
+ *
+ * ԭ
+ * - ֻʹôɫϵͳ壬κδԤصͼƬ
+ */
+class LoadingView : public cocos2d::Node {
+public:
+    static LoadingView* create();
+    bool init() override;
+
+    /**
+     * @brief ½
+     * @param done ɵ
+     * @param total 
+     */
+    void setProgress(int done, int total);
+
+private:
+    cocos2d::LayerColor* _bar;   ///< 
+    cocos2d::Label* _label;      ///< ٷֱı
+};
+
+#endif // __LOADING_VIEW_H__
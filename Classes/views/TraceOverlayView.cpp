@@ -0,0 +1,70 @@
+// --------------------------------------------------------
+// ļ: Classes/views/TraceOverlayView.cpp
+// --------------------------------------------------------
+#include "TraceOverlayView.h"
+
+#if CM_ENABLE_TRACE
+
+#include <cstdio>
+
+USING_NS_CC;
+
+namespace {
+    const float kRefreshInterval = 0.5f;  ///< ˢ¼룩
+    const size_t kMaxRows = 8;            ///< ʾ
+}
+
+TraceOverlayView* TraceOverlayView::create() {
+    TraceOverlayView* view = new (std::nothrow) TraceOverlayView();
+    if (view && view->init()) {
+        view->autorelease();
+        return view;
+    }
+    CC_SAFE_DELETE(view);
+    return nullptr;
+}
+
+bool TraceOverlayView::init() {
+    if (!Node::init()) return false;
+
+    auto director = Director::getInstance();
+    Size visibleSize = director->getVisibleSize();
+    Vec2 origin = director->getVisibleOrigin();
+
+    _background = LayerColor::create(Color4B(0, 0, 0, 140), 640, 40);
+    _background->setPosition(origin.x, origin.y + visibleSize.height - 40);
+    this->addChild(_background);
+
+    _label = Label::createWithSystemFont("trace: collecting...", "Arial", 22);
+    _label->setAnchorPoint(Vec2(0.0f, 1.0f));
+    _label->setPosition(origin.x + 10, origin.y + visibleSize.height - 8);
+    _label->setTextColor(Color4B(120, 255, 120, 255));
+    this->addChild(_label, 1);
+
+    this->schedule(CC_CALLBACK_1(TraceOverlayView::refresh, this), kRefreshInterval, "trace_overlay_refresh");
+    return true;
+}
+
+void TraceOverlayView::refresh(float dt) {
+    TraceProfiler::getInstance()->collect();
+    auto summaries = TraceProfiler::getInstance()->getSummaries();
+
+    std::string text = "scope  p50 / p95 / p99 (ms)  max allocs";
+    char line[160];
+    for (size_t i = 0; i < summaries.size() && i < kMaxRows; ++i) {
+        const auto& s = summaries[i];
+        snprintf(line, sizeof(line), "\n%s  %.2f / %.2f / %.2f  a%u  x%llu",
+                 s.name.c_str(), s.p50, s.p95, s.p99, s.allocMax, (unsigned long long)s.totalCount);
+        text += line;
+    }
+    _label->setString(text);
+
+    // ߶仯
+    float height = _label->getContentSize().height + 16;
+    auto director = Director::getInstance();
+    Vec2 origin = director->getVisibleOrigin();
+    _background->changeWidthAndHeight(640, height);
+    _background->setPosition(origin.x, origin.y + director->getVisibleSize().height - height);
+}
+
+#endif // CM_ENABLE_TRACE
@@ -0,0 +1,45 @@
+// --------------------------------------------------------
+// ļ: Classes/views/TraceOverlayView.h
+// --------------------------------------------------------
+#ifndef __TRACE_OVERLAY_VIEW_H__
+#define __TRACE_OVERLAY_VIEW_H__
+
+#include "cocos2d.h"
+#include "utils/TraceProfiler.h"
+
+#if CM_ENABLE_TRACE
+
+/**
+ * @class TraceOverlayView
+ * @brief ĻϽǵͳƸ
+ *
+ * ְ
+ * - Ե TraceProfiler::collect() ׷¼
+ * - ʾʱߵ p50/p95/p99룩
+ *
+ * ʹó
+ * Debug  GameController ӵϲ
+ *
+ * ԭ
+ * - ֻȡͳƽϷ߼
+ * - ˢƵԶ֡ʣ⸡㱾Ϊȵ
+ */
+class TraceOverlayView : public cocos2d::Node {
+public:
+    static TraceOverlayView* create();
+    bool init() override;
+
+private:
+    /**
+     * @brief ¼ˢʾı
+     * @param dt ϴˢµʱ
+     */
+    void refresh(float dt);
+
+    cocos2d::LayerColor* _background;  ///< ͸
+    cocos2d::Label* _label;            ///< ͳı
+};
+
+#endif // CM_ENABLE_TRACE
+
+#endif // __TRACE_OVERLAY_VIEW_H__
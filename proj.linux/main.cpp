@@ -23,6 +23,7 @@
  ****************************************************************************/
 
 #include "../Classes/AppDelegate.h"
+#include "../Classes/utils/StartupTimeline.h"
 
 #include <stdlib.h>
 #include <stdio.h>
@@ -33,6 +34,9 @@ USING_NS_CC;
 
 int main(int argc, char **argv)
 {
+    // cold-start timeline origin
+    StartupTimeline::mark("main");
+
     // create the application instance
     AppDelegate app;
     return Application::getInstance()->run();
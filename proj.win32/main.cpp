@@ -24,6 +24,7 @@
 
 #include "main.h"
 #include "AppDelegate.h"
+#include "utils/StartupTimeline.h"
 #include "cocos2d.h"
 
 USING_NS_CC;
@@ -36,6 +37,9 @@ int WINAPI _tWinMain(HINSTANCE hInstance,
     UNREFERENCED_PARAMETER(hPrevInstance);
     UNREFERENCED_PARAMETER(lpCmdLine);
 
+    // cold-start timeline origin
+    StartupTimeline::mark("main");
+
     // create the application instance
     AppDelegate app;
     return Application::getInstance()->run();
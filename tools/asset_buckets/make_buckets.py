@@ -0,0 +1,225 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+分辨率档位美术生成工具（在开发机上运行，依赖 Pillow）
+
+    python tools/asset_buckets/make_buckets.py
+    python tools/asset_buckets/make_buckets.py --bucket medium --check
+
+以 Resources/ 根目录下的原始美术为源，按每个资源在游戏中的显示尺寸预先缩放，
+输出到 Resources/<档位>/ 下，目录结构与源一致。运行时 AppDelegate 按屏幕宽度选择档位，
+把档位目录加入 FileUtils 的分辨率搜索顺序，并把 ContentScaleFactor 设为档位缩放；
+档位中有的资源不再在运行时缩放，没有的资源回退到原始美术，由 AssetBuckets 按档位缩放补偿。
+
+small、medium 档位不生成像素数多于原始美术的文件（原始美术本身就低于显示尺寸时直接回退），
+纹理内存不超过原始美术；只有 large 档位放大美术换取清晰度。--report 输出各档位的纹理内存。
+
+同时写出启动预载清单 Resources/preload.json。
+
+档位表与 Classes/utils/AssetBuckets.cpp 中的 kBuckets 保持一致。
+"""
+
+import argparse
+import glob
+import json
+import os
+import sys
+
+from PIL import Image
+
+# 档位目录、缩放和是否允许放大：缩放 1.0 表示 1 个设计单位对应 1 个像素（1080 宽设计分辨率）；
+# 不允许放大的档位跳过像素数多于原始美术的文件，运行时回退到原始美术
+BUCKETS = [
+    ("small", 0.5, False),
+    ("medium", 1.0, False),
+    ("large", 1.5, True),
+]
+
+# 资源清单：每项是 (源文件通配符, 规则, 参数, 是否预载)，尺寸均以设计单位表示
+#   scale  按倍数缩放，参数是运行时原先对该资源施加的缩放
+#   width  等比缩放到指定宽度
+#   cover  等比缩放到覆盖指定区域并居中裁剪
+# 标记为预载的资源写入 Resources/preload.json，启动时由 AssetPreloader 并行解码
+MANIFEST = [
+    # 卡牌底座：CardView 和备用牌堆原先放大 3 倍（GameConstants.h 的 kCardViewScale）
+    ("card_general.png", "scale", 3.0, True),
+    # 花色图标：CardView 按卡牌底座宽度的 1/3 显示
+    ("suits/*.png", "width", 182, True),
+    # 点数：CardView 在 3 倍底座内再缩放 0.4；目前只显示大号点数
+    ("number/big_*.png", "scale", 1.2, True),
+    ("number/small_*.png", "scale", 1.2, False),
+    # 背景：覆盖 1080 宽、最高 20:9 的可视区域，更矮的屏幕由 GameView 居中裁掉上下边
+    ("kitty.jpg", "cover", (1080, 2400), True),
+]
+
+PRELOAD_MANIFEST = "preload.json"
+
+JPEG_QUALITY = 90
+
+
+def target_size(image, rule, param, bucket_scale):
+    w, h = image.size
+    if rule == "scale":
+        factor = param * bucket_scale
+    elif rule == "width":
+        factor = param * bucket_scale / float(w)
+    elif rule == "cover":
+        factor = max(param[0] * bucket_scale / float(w), param[1] * bucket_scale / float(h))
+    else:
+        raise ValueError("unknown rule: " + rule)
+    return max(1, int(round(w * factor))), max(1, int(round(h * factor)))
+
+
+def output_size(image, rule, param, bucket_scale):
+    """档位文件的最终尺寸（cover 为裁剪后的尺寸）"""
+    if rule == "cover":
+        return int(round(param[0] * bucket_scale)), int(round(param[1] * bucket_scale))
+    return target_size(image, rule, param, bucket_scale)
+
+
+def is_upscaled(src_path, rule, param, bucket_scale):
+    """档位文件的像素数是否多于原始美术"""
+    image = Image.open(src_path)
+    w, h = output_size(image, rule, param, bucket_scale)
+    return w * h > image.size[0] * image.size[1]
+
+
+def texture_bytes(path):
+    """按 cocos2d 默认像素格式估算纹理内存：JPEG 为 RGB888，其余为 RGBA8888"""
+    w, h = Image.open(path).size
+    return w * h * (3 if path.lower().endswith((".jpg", ".jpeg")) else 4)
+
+
+def process(src_path, dst_path, rule, param, bucket_scale):
+    image = Image.open(src_path)
+    image.load()
+    size = target_size(image, rule, param, bucket_scale)
+    result = image.resize(size, Image.LANCZOS)
+
+    if rule == "cover":
+        crop_w = int(round(param[0] * bucket_scale))
+        crop_h = int(round(param[1] * bucket_scale))
+        left = (result.width - crop_w) // 2
+        top = (result.height - crop_h) // 2
+        result = result.crop((left, top, left + crop_w, top + crop_h))
+
+    os.makedirs(os.path.dirname(dst_path), exist_ok=True)
+    if dst_path.lower().endswith((".jpg", ".jpeg")):
+        result.convert("RGB").save(dst_path, quality=JPEG_QUALITY, optimize=True)
+    else:
+        result.save(dst_path, optimize=True)
+    return image.size, result.size
+
+
+def is_stale(src_path, dst_path):
+    return not os.path.exists(dst_path) or os.path.getmtime(dst_path) < os.path.getmtime(src_path)
+
+
+def preload_paths(resources):
+    paths = []
+    for pattern, _, _, preload in MANIFEST:
+        if preload:
+            for src_path in sorted(glob.glob(os.path.join(resources, pattern))):
+                paths.append(os.path.relpath(src_path, resources).replace(os.sep, "/"))
+    return paths
+
+
+def write_preload_manifest(resources, check):
+    """写出预载清单；路径与档位无关，运行时按分辨率搜索顺序解析到当前档位"""
+    path = os.path.join(resources, PRELOAD_MANIFEST)
+    content = json.dumps({"Textures": preload_paths(resources)}, indent=4) + "\n"
+    current = open(path).read() if os.path.exists(path) else None
+    if current == content:
+        return False
+    if not check:
+        with open(path, "w") as f:
+            f.write(content)
+    print(("stale: " if check else "written: ") + PRELOAD_MANIFEST)
+    return True
+
+
+def report(resources):
+    """输出原始美术和各档位的纹理内存（档位中没有的文件按回退的原始美术计）"""
+    rows = [("source", None)] + [(name, name) for name, _, _ in BUCKETS]
+    for label, bucket in rows:
+        preload = 0
+        total = 0
+        for pattern, _, _, is_preload in MANIFEST:
+            for src_path in sorted(glob.glob(os.path.join(resources, pattern))):
+                path = src_path
+                if bucket:
+                    bucket_path = os.path.join(resources, bucket, os.path.relpath(src_path, resources))
+                    if os.path.exists(bucket_path):
+                        path = bucket_path
+                size = texture_bytes(path)
+                total += size
+                if is_preload:
+                    preload += size
+        print("%-7s preload %6.2f MB, all %6.2f MB" % (label, preload / 1048576.0, total / 1048576.0))
+
+
+def main():
+    root = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+    parser = argparse.ArgumentParser(description="生成各分辨率档位的预缩放美术")
+    parser.add_argument("--resources", default=os.path.join(root, "Resources"), help="资源根目录")
+    parser.add_argument("--bucket", action="append", help="只处理指定档位（可重复）")
+    parser.add_argument("--force", action="store_true", help="源文件未修改时也重新生成")
+    parser.add_argument("--check", action="store_true", help="只检查输出是否最新，过期时以退出码 1 结束")
+    parser.add_argument("--report", action="store_true", help="只输出各档位的纹理内存")
+    args = parser.parse_args()
+
+    if args.report:
+        report(args.resources)
+        return 0
+
+    buckets = [b for b in BUCKETS if not args.bucket or b[0] in args.bucket]
+    if not buckets:
+        print("no such bucket: " + ", ".join(args.bucket))
+        return 2
+
+    stale = 0
+    written = 0
+    for name, bucket_scale, allow_upscale in buckets:
+        for pattern, rule, param, _ in MANIFEST:
+            sources = sorted(glob.glob(os.path.join(args.resources, pattern)))
+            if not sources:
+                print("missing source: " + pattern)
+                return 2
+            for src_path in sources:
+                rel = os.path.relpath(src_path, args.resources)
+                dst_path = os.path.join(args.resources, name, rel)
+                if not allow_upscale and is_upscaled(src_path, rule, param, bucket_scale):
+                    # 回退到原始美术；删除以前生成的放大文件
+                    if os.path.exists(dst_path):
+                        if args.check:
+                            print("stale: " + os.path.join(name, rel))
+                            stale += 1
+                        else:
+                            os.remove(dst_path)
+                            try:
+                                os.removedirs(os.path.dirname(dst_path))
+                            except OSError:
+                                pass
+                            print("%s/%s: removed (source art is used)" % (name, rel))
+                    continue
+                if not args.force and not is_stale(src_path, dst_path):
+                    continue
+                if args.check:
+                    print("stale: " + os.path.join(name, rel))
+                    stale += 1
+                    continue
+                src_size, dst_size = process(src_path, dst_path, rule, param, bucket_scale)
+                print("%s/%s: %dx%d -> %dx%d" % (name, rel, src_size[0], src_size[1], dst_size[0], dst_size[1]))
+                written += 1
+
+    if write_preload_manifest(args.resources, args.check):
+        stale += 1
+
+    if args.check:
+        return 1 if stale else 0
+    print("%d files written" % written)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,76 @@
+// --------------------------------------------------------
+// ļ: tools/common/LevelFileReader.cpp
+// --------------------------------------------------------
+#include "LevelFileReader.h"
+#include "json/document.h"
+#include <fstream>
+#include <sstream>
+
+namespace {
+    bool parseCardArray(const rapidjson::Value& array, bool includePosition, std::vector<CardConfigData>& cards) {
+        for (rapidjson::SizeType i = 0; i < array.Size(); i++) {
+            const rapidjson::Value& card = array[i];
+            if (!card.IsObject() || !card.HasMember("CardFace") || !card.HasMember("CardSuit")) return false;
+
+            CardConfigData data;
+            data.face = card["CardFace"].GetInt() + 1;
+            data.suit = card["CardSuit"].GetInt();
+            data.x = (includePosition && card.HasMember("Position")) ? card["Position"]["x"].GetFloat() : 0.0f;
+            data.y = (includePosition && card.HasMember("Position")) ? card["Position"]["y"].GetFloat() : 0.0f;
+
+            if (card.HasMember("CoveredBy") && card["CoveredBy"].IsArray()) {
+                const rapidjson::Value& covers = card["CoveredBy"];
+                for (rapidjson::SizeType j = 0; j < covers.Size(); j++) {
+                    data.coveredBy.push_back(covers[j].GetInt());
+                }
+            }
+            cards.push_back(data);
+        }
+        return true;
+    }
+}
+
+bool readTextFile(const std::string& path, std::string& content) {
+    std::ifstream file(path.c_str(), std::ios::in | std::ios::binary);
+    if (!file) return false;
+
+    std::ostringstream stream;
+    stream << file.rdbuf();
+    content = stream.str();
+    return true;
+}
+
+bool readLevelFile(const std::string& path, LevelConfig& config, std::string& error) {
+    std::string content;
+    if (!readTextFile(path, content)) {
+        error = "cannot read file";
+        return false;
+    }
+
+    rapidjson::Document doc;
+    doc.Parse(content.c_str());
+    if (doc.HasParseError() || !doc.IsObject()) {
+        error = "not a valid level file";
+        return false;
+    }
+
+    config = LevelConfig();
+    if (doc.HasMember("Playfield") && doc["Playfield"].IsArray()
+        && !parseCardArray(doc["Playfield"], true, config.playfieldCards)) {
+        error = "malformed Playfield card";
+        return false;
+    }
+    if (doc.HasMember("Stack") && doc["Stack"].IsArray()
+        && !parseCardArray(doc["Stack"], false, config.stackCards)) {
+        error = "malformed Stack card";
+        return false;
+    }
+    config.occlusionResolved = doc.HasMember("OcclusionBaked") && doc["OcclusionBaked"].IsBool()
+        && doc["OcclusionBaked"].GetBool();
+    if (doc.HasMember("MatchRule") && doc["MatchRule"].IsString()
+        && !parseMatchRuleName(doc["MatchRule"].GetString(), config.matchRule)) {
+        error = std::string("unknown MatchRule ") + doc["MatchRule"].GetString();
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,27 @@
+// --------------------------------------------------------
+// ļ: tools/common/LevelFileReader.h
+// --------------------------------------------------------
+// ߹߹õĹؿļȡֶκʱ LevelConfigLoader һ£CardFace + 1 Ϊ
+
+#ifndef __LEVEL_FILE_READER_H__
+#define __LEVEL_FILE_READER_H__
+
+#include "configs/LevelConfig.h"
+#include <string>
+
+/**
+ * @brief ȡļ
+ * @return ļڻ޷ȡ false
+ */
+bool readTextFile(const std::string& path, std::string& content);
+
+/**
+ * @brief ȡؿļ
+ * @param path ؿ JSON ļ·
+ * @param config ؿ
+ * @param error ʧԭ
+ * @return ȡɹ true
+ */
+bool readLevelFile(const std::string& path, LevelConfig& config, std::string& error);
+
+#endif
@@ -0,0 +1,166 @@
+// --------------------------------------------------------
+// ļ: tools/level_compiler/LevelCompiler.cpp
+// --------------------------------------------------------
+// ؿ빤ߣ߼ϷƵڵϵдؿļ CoveredBy б
+//
+// ÷
+//   level_compiler <input.json> [-o <output.json>] [--jitter <px>] [--strict]
+//
+//   -o        ļĬϸļ
+//   --jitter  ȶԼλöȣأĬ 20 ʾ
+//   --strict  ڲȶĿƶʱط˳룬дļ
+//
+// ڵʱ Classes/services/OcclusionResolverϷμ
+
+#include "services/OcclusionResolver.h"
+#include "json/document.h"
+#include "json/prettywriter.h"
+#include "json/stringbuffer.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace {
+    struct Options {
+        std::string input;
+        std::string output;
+        float jitter;
+        bool strict;
+    };
+
+    void printUsage() {
+        fprintf(stderr, "usage: level_compiler <input.json> [-o <output.json>] [--jitter <px>] [--strict]\n");
+    }
+
+    bool parseOptions(int argc, char** argv, Options& options) {
+        options.jitter = 2.0f;
+        options.strict = false;
+
+        for (int i = 1; i < argc; i++) {
+            if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+                options.output = argv[++i];
+            }
+            else if (strcmp(argv[i], "--jitter") == 0 && i + 1 < argc) {
+                options.jitter = (float)atof(argv[++i]);
+            }
+            else if (strcmp(argv[i], "--strict") == 0) {
+                options.strict = true;
+            }
+            else if (argv[i][0] != '-' && options.input.empty()) {
+                options.input = argv[i];
+            }
+            else {
+                return false;
+            }
+        }
+
+        if (options.output.empty()) options.output = options.input;
+        return !options.input.empty();
+    }
+
+    bool readFile(const std::string& path, std::string& content) {
+        std::ifstream file(path.c_str(), std::ios::in | std::ios::binary);
+        if (!file) return false;
+
+        std::ostringstream stream;
+        stream << file.rdbuf();
+        content = stream.str();
+        return true;
+    }
+
+    bool writeFile(const std::string& path, const char* data, size_t size) {
+        std::ofstream file(path.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!file) return false;
+
+        file.write(data, size);
+        file.put('\n');
+        return file.good();
+    }
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 1;
+    }
+
+    std::string content;
+    if (!readFile(options.input, content)) {
+        fprintf(stderr, "error: cannot read %s\n", options.input.c_str());
+        return 1;
+    }
+
+    rapidjson::Document doc;
+    doc.Parse(content.c_str());
+    if (doc.HasParseError() || !doc.IsObject()) {
+        fprintf(stderr, "error: %s is not a valid level file\n", options.input.c_str());
+        return 1;
+    }
+    if (!doc.HasMember("Playfield") || !doc["Playfield"].IsArray()) {
+        fprintf(stderr, "error: %s has no Playfield array\n", options.input.c_str());
+        return 1;
+    }
+
+    // 1. ȡϷ꣨ LevelConfigLoader һ£ȱ Position Ϊԭ㣩
+    rapidjson::Value& playfield = doc["Playfield"];
+    LevelConfig config;
+    for (rapidjson::SizeType i = 0; i < playfield.Size(); i++) {
+        const rapidjson::Value& card = playfield[i];
+        CardConfigData data;
+        data.face = 0;
+        data.suit = 0;
+        data.x = card.HasMember("Position") ? card["Position"]["x"].GetFloat() : 0.0f;
+        data.y = card.HasMember("Position") ? card["Position"]["y"].GetFloat() : 0.0f;
+        config.playfieldCards.push_back(data);
+    }
+
+    // 2. ȶԼ飺΢仯ͻıڵĲ֣ڲͬ豸ױֲһ
+    if (options.jitter > 0.0f) {
+        std::vector<OcclusionConflict> conflicts = OcclusionResolver::findJitterConflicts(config, options.jitter);
+        for (const auto& conflict : conflicts) {
+            const CardConfigData& upper = config.playfieldCards[conflict.upper];
+            const CardConfigData& lower = config.playfieldCards[conflict.lower];
+            fprintf(stderr, "warning: card %d (%.1f, %.1f) %s card %d (%.1f, %.1f), unstable under %.1fpx jitter\n",
+                    conflict.upper, upper.x, upper.y, conflict.covers ? "covers" : "nearly covers",
+                    conflict.lower, lower.x, lower.y, options.jitter);
+        }
+        if (!conflicts.empty() && options.strict) {
+            fprintf(stderr, "error: %d unstable card pair(s), level not written\n", (int)conflicts.size());
+            return 2;
+        }
+    }
+
+    // 3. ڵϵдÿſ
+    OcclusionResolver::resolve(config);
+
+    rapidjson::Document::AllocatorType& allocator = doc.GetAllocator();
+    int coverCount = 0;
+    for (rapidjson::SizeType i = 0; i < playfield.Size(); i++) {
+        rapidjson::Value covers(rapidjson::kArrayType);
+        for (int coverIndex : config.playfieldCards[i].coveredBy) {
+            covers.PushBack(coverIndex, allocator);
+            coverCount++;
+        }
+        playfield[i].RemoveMember("CoveredBy");
+        playfield[i].AddMember("CoveredBy", covers, allocator);
+    }
+    doc.RemoveMember("OcclusionBaked");
+    doc.AddMember("OcclusionBaked", true, allocator);
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+    writer.SetIndent(' ', 4);
+    doc.Accept(writer);
+
+    if (!writeFile(options.output, buffer.GetString(), buffer.GetSize())) {
+        fprintf(stderr, "error: cannot write %s\n", options.output.c_str());
+        return 1;
+    }
+
+    printf("%s: %d cards, %d cover links\n", options.output.c_str(), (int)playfield.Size(), coverCount);
+    return 0;
+}
@@ -0,0 +1,188 @@
+// --------------------------------------------------------
+// ļ: tools/level_dedup/LevelDedup.cpp
+// --------------------------------------------------------
+// ؿȥعߣȥɫĹ淶ǩ¹ؿǷѷؿȼ
+//
+// ÷
+//   level_dedup [--index <signatures.txt>] [--update] [--solve] <level.json>...
+//
+//   --index   ѷؿǩĬ tools/level_dedup/shipped_levels.txt
+//   --update  ͨĹؿǩ׷ӵ
+//   --solve   ͨĹؿ⣬Աûȥɫǰչ״̬
+//
+// ƥֻֻлɫͬؿ˵ͬһؿ
+// һؿܾʱ˳ 2ֱӽؿ
+
+#include "LevelFileReader.h"
+#include "services/LevelSignature.h"
+#include "services/LevelSolver.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef CARDMATCH_DEFAULT_INDEX
+#define CARDMATCH_DEFAULT_INDEX "shipped_levels.txt"
+#endif
+
+namespace {
+    struct Options {
+        std::string index;
+        bool update;
+        bool solve;
+        std::vector<std::string> levels;
+    };
+
+    void printUsage() {
+        fprintf(stderr, "usage: level_dedup [--index <signatures.txt>] [--update] [--solve] <level.json>...\n");
+    }
+
+    bool parseOptions(int argc, char** argv, Options& options) {
+        options.index = CARDMATCH_DEFAULT_INDEX;
+        options.update = false;
+        options.solve = false;
+
+        for (int i = 1; i < argc; i++) {
+            if (strcmp(argv[i], "--index") == 0 && i + 1 < argc) {
+                options.index = argv[++i];
+            }
+            else if (strcmp(argv[i], "--update") == 0) {
+                options.update = true;
+            }
+            else if (strcmp(argv[i], "--solve") == 0) {
+                options.solve = true;
+            }
+            else if (argv[i][0] != '-') {
+                options.levels.push_back(argv[i]);
+            }
+            else {
+                return false;
+            }
+        }
+        return !options.levels.empty();
+    }
+
+    /**
+     * @brief ȡǩÿһʮǩɸؿ# ͷΪע
+     */
+    bool loadIndex(const std::string& path, std::map<uint64_t, std::string>& index) {
+        std::string content;
+        if (!readTextFile(path, content)) return false;
+
+        std::istringstream lines(content);
+        std::string line;
+        while (std::getline(lines, line)) {
+            if (line.empty() || line[0] == '#') continue;
+
+            std::istringstream fields(line);
+            std::string hex;
+            std::string name;
+            fields >> hex >> name;
+
+            uint64_t signature = 0;
+            if (LevelSignature::fromHex(hex, signature)) {
+                index[signature] = name.empty() ? hex : name;
+            }
+        }
+        return true;
+    }
+
+    std::string baseName(const std::string& path) {
+        size_t slash = path.find_last_of("/\\");
+        return slash == std::string::npos ? path : path.substr(slash + 1);
+    }
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 1;
+    }
+
+    std::map<uint64_t, std::string> index;
+    if (!loadIndex(options.index, index)) {
+        fprintf(stderr, "warning: index %s not found, starting empty\n", options.index.c_str());
+    }
+    size_t shippedCount = index.size();
+
+    std::set<uint64_t> exactDeals;
+    std::vector<std::pair<uint64_t, std::string>> accepted;
+    int rejected = 0;
+    int failed = 0;
+    size_t rawStates = 0;
+    size_t canonicalStates = 0;
+
+    for (const auto& path : options.levels) {
+        LevelConfig config;
+        std::string error;
+        if (!readLevelFile(path, config, error)) {
+            fprintf(stderr, "error: %s: %s\n", path.c_str(), error.c_str());
+            failed++;
+            continue;
+        }
+
+        exactDeals.insert(LevelSignature::compute(config, true));
+        uint64_t signature = LevelSignature::compute(config);
+
+        auto found = index.find(signature);
+        if (found != index.end()) {
+            printf("reject %s: equivalent to %s (%s)\n", path.c_str(), found->second.c_str(),
+                   LevelSignature::toHex(signature).c_str());
+            rejected++;
+            continue;
+        }
+        index[signature] = baseName(path);
+        accepted.push_back(std::make_pair(signature, baseName(path)));
+        printf("accept %s (%s)\n", path.c_str(), LevelSignature::toHex(signature).c_str());
+
+        if (options.solve) {
+            SolverOptions solverOptions;
+            solverOptions.suitSymmetry = false;
+            SolverResult raw = LevelSolver::solve(config, solverOptions);
+            solverOptions.suitSymmetry = true;
+            SolverResult canonical = LevelSolver::solve(config, solverOptions);
+
+            if (!canonical.supported) {
+                printf("    solver: more than %d playfield cards, skipped\n", LevelSolver::kMaxPlayfieldCards);
+                continue;
+            }
+            rawStates += raw.statesVisited;
+            canonicalStates += canonical.statesVisited;
+            printf("    solver: %s, %zu moves, states %zu -> %zu%s\n",
+                   canonical.solvable ? "solvable" : "unsolvable", canonical.solution.size(),
+                   raw.statesVisited, canonical.statesVisited,
+                   canonical.exhausted ? " (state limit reached)" : "");
+        }
+    }
+
+    // ȥǰ棨ɫֵĹؿȥغĹ淶ؿ
+    printf("pack: %d file(s), %zu distinct deal(s) with suits, %zu after suit erasure, %d rejected\n",
+           (int)options.levels.size() - failed, exactDeals.size(), accepted.size(), rejected);
+    if (options.solve && rawStates > 0) {
+        printf("solver states: %zu with suits, %zu after suit erasure (%.1f%%)\n",
+               rawStates, canonicalStates, 100.0 * canonicalStates / rawStates);
+    }
+
+    if (options.update && !accepted.empty()) {
+        std::ofstream file(options.index.c_str(), std::ios::out | std::ios::app);
+        if (!file) {
+            fprintf(stderr, "error: cannot write %s\n", options.index.c_str());
+            return 1;
+        }
+        if (shippedCount == 0) {
+            file << "# level_dedup ǩȥɫ淶ǩ + ؿ\n";
+        }
+        for (const auto& entry : accepted) {
+            file << LevelSignature::toHex(entry.first) << " " << entry.second << "\n";
+        }
+        printf("index: %zu signature(s) appended to %s\n", accepted.size(), options.index.c_str());
+    }
+
+    if (failed > 0) return 1;
+    return rejected > 0 ? 2 : 0;
+}
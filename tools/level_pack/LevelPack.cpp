@@ -0,0 +1,214 @@
+// --------------------------------------------------------
+// ļ: tools/level_pack/LevelPack.cpp
+// --------------------------------------------------------
+// ؿɹߣӻԭؿ⣬ֻӺĹؿ
+//
+// ÷
+//   level_pack [--layout <name>]... [--count <n>] [--first <serial>] [--all] [--max-states <n>] [-o <pack.json>]
+//   level_pack --daily <yyyy-mm-dd>
+//
+//   --layout      ģ壨Pyramid / TwinStairs / TriPeaksظģȡӣĬȫ
+//   --count       ؿĬ 20
+//   --first       һţĬ 1
+//   --all         ɽĹؿĬֻɽģ
+//   --max-states  ؿ״̬ޣΪɽ
+//   -o            ļĬд׼
+//   --daily       ָڵÿս⵱ĺѡӣӡһɽ
+//
+// ѡؿȥɫȼ۵ӣLevelSignature ͬᱻ
+
+#include "services/LevelMaterializer.h"
+#include "services/LevelSignature.h"
+#include "services/LevelSolver.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+    struct Options {
+        std::vector<LevelLayoutType> layouts;
+        int count;
+        uint64_t firstSerial;
+        bool keepUnsolvable;
+        size_t maxStates;
+        std::string output;
+        std::string daily;
+    };
+
+    struct PackLevel {
+        uint64_t seed;
+        bool solvable;
+        size_t moves;
+    };
+
+    const int kMaxDailyAttempts = 1000;
+
+    void printUsage() {
+        fprintf(stderr, "usage: level_pack [--layout <name>]... [--count <n>] [--first <serial>] [--all]"
+                        " [--max-states <n>] [-o <pack.json>]\n"
+                        "       level_pack --daily <yyyy-mm-dd>\n");
+    }
+
+    bool parseOptions(int argc, char** argv, Options& options) {
+        options.count = 20;
+        options.firstSerial = 1;
+        options.keepUnsolvable = false;
+        options.maxStates = SolverOptions().maxStates;
+
+        for (int i = 1; i < argc; i++) {
+            bool hasValue = i + 1 < argc;
+            if (strcmp(argv[i], "--layout") == 0 && hasValue) {
+                LevelLayoutType layout;
+                if (!LevelMaterializer::parseLayoutName(argv[++i], layout)) {
+                    fprintf(stderr, "error: unknown layout %s\n", argv[i]);
+                    return false;
+                }
+                options.layouts.push_back(layout);
+            }
+            else if (strcmp(argv[i], "--count") == 0 && hasValue) {
+                options.count = atoi(argv[++i]);
+            }
+            else if (strcmp(argv[i], "--first") == 0 && hasValue) {
+                options.firstSerial = strtoull(argv[++i], nullptr, 10);
+            }
+            else if (strcmp(argv[i], "--all") == 0) {
+                options.keepUnsolvable = true;
+            }
+            else if (strcmp(argv[i], "--max-states") == 0 && hasValue) {
+                options.maxStates = (size_t)strtoull(argv[++i], nullptr, 10);
+            }
+            else if (strcmp(argv[i], "-o") == 0 && hasValue) {
+                options.output = argv[++i];
+            }
+            else if (strcmp(argv[i], "--daily") == 0 && hasValue) {
+                options.daily = argv[++i];
+            }
+            else {
+                return false;
+            }
+        }
+
+        if (options.layouts.empty()) {
+            for (int i = 0; i < LLT_NUM_LAYOUTS; i++) {
+                options.layouts.push_back((LevelLayoutType)i);
+            }
+        }
+        return options.count > 0;
+    }
+
+    double elapsedUs(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    int findDaily(const Options& options) {
+        int year = 0;
+        int month = 0;
+        int day = 0;
+        if (sscanf(options.daily.c_str(), "%d-%d-%d", &year, &month, &day) != 3
+            || month < 1 || month > 12 || day < 1 || day > 31) {
+            fprintf(stderr, "error: invalid date %s, expected yyyy-mm-dd\n", options.daily.c_str());
+            return 1;
+        }
+
+        SolverOptions solverOptions;
+        solverOptions.maxStates = options.maxStates;
+        for (int attempt = 0; attempt < kMaxDailyAttempts; attempt++) {
+            uint64_t seed = LevelMaterializer::getDailyCandidate(year, month, day, attempt);
+            LevelConfig config;
+            LevelMaterializer::materialize(seed, config);
+
+            SolverResult result = LevelSolver::solve(config, solverOptions);
+            if (result.solvable) {
+                printf("%s %s %s attempt=%d moves=%zu\n", options.daily.c_str(),
+                       LevelMaterializer::formatSeed(seed).c_str(),
+                       LevelMaterializer::getLayoutName(LevelMaterializer::getLayout(seed)),
+                       attempt, result.solution.size());
+                return 0;
+            }
+        }
+        fprintf(stderr, "error: no solvable candidate for %s in %d attempts\n", options.daily.c_str(), kMaxDailyAttempts);
+        return 1;
+    }
+
+    bool writePack(const Options& options, const std::vector<PackLevel>& levels) {
+        FILE* file = options.output.empty() ? stdout : fopen(options.output.c_str(), "w");
+        if (!file) {
+            fprintf(stderr, "error: cannot write %s\n", options.output.c_str());
+            return false;
+        }
+
+        // дʮַJSON ֵںֻܶ 53 λ
+        fprintf(file, "{\n    \"Levels\": [\n");
+        for (size_t i = 0; i < levels.size(); i++) {
+            fprintf(file, "        { \"Seed\": \"%s\", \"Solvable\": %s, \"Moves\": %zu }%s\n",
+                    LevelMaterializer::formatSeed(levels[i].seed).c_str(),
+                    levels[i].solvable ? "true" : "false", levels[i].moves,
+                    i + 1 < levels.size() ? "," : "");
+        }
+        fprintf(file, "    ]\n}\n");
+
+        if (file != stdout) fclose(file);
+        return true;
+    }
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 1;
+    }
+    if (!options.daily.empty()) {
+        return findDaily(options);
+    }
+
+    SolverOptions solverOptions;
+    solverOptions.maxStates = options.maxStates;
+
+    std::set<uint64_t> signatures;
+    std::vector<PackLevel> levels;
+    int tried = 0;
+    int duplicates = 0;
+    int unsolvable = 0;
+    double materializeUs = 0.0;
+
+    for (uint64_t serial = options.firstSerial; (int)levels.size() < options.count; serial++) {
+        for (size_t i = 0; i < options.layouts.size() && (int)levels.size() < options.count; i++) {
+            uint64_t seed = LevelMaterializer::makeSeed(options.layouts[i], serial);
+            tried++;
+
+            auto start = std::chrono::steady_clock::now();
+            LevelConfig config;
+            LevelMaterializer::materialize(seed, config);
+            materializeUs += elapsedUs(start);
+
+            if (!signatures.insert(LevelSignature::compute(config)).second) {
+                duplicates++;
+                continue;
+            }
+
+            SolverResult result = LevelSolver::solve(config, solverOptions);
+            bool solvable = result.solvable && !result.exhausted;
+            if (!solvable) {
+                unsolvable++;
+                if (!options.keepUnsolvable) continue;
+            }
+
+            PackLevel level;
+            level.seed = seed;
+            level.solvable = solvable;
+            level.moves = solvable ? result.solution.size() : 0;
+            levels.push_back(level);
+        }
+    }
+
+    if (!writePack(options, levels)) return 1;
+
+    fprintf(stderr, "pack: %zu level(s) from %d seed(s), %d unsolvable, %d duplicate(s); materialize %.2f us/level\n",
+            levels.size(), tried, unsolvable, duplicates, materializeUs / tried);
+    return 0;
+}
@@ -0,0 +1,132 @@
+// --------------------------------------------------------
+// ļ: tools/telemetry_decode/TelemetryDecode.cpp
+// --------------------------------------------------------
+// Ծң빤ߣȡϷд telemetry.bin¼ CSV 򰴹ؿ
+//
+// ÷
+//   telemetry_decode [--summary] <telemetry.bin>...
+//
+//   --summary  ÿһУؿʶƽ˼ʱ
+//
+// ļ˳ƴӣֻľļtelemetry.bin.1Ӧǰ
+
+#include "managers/TelemetryRecorder.h"
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+    /**
+     * @brief һֵĻ
+     */
+    struct GameSummary {
+        uint32_t levelId;
+        int result;            ///< 1 ʤ0 ʧܡ-1 δ
+        int moves;             ///< ơƺͳ
+        int typeCounts[TET_GAME_OVER + 1];
+        int undoCount;
+        uint64_t thinkMsTotal;
+        uint32_t thinkMsMax;
+        int cardsRemaining;
+        int stockCount;
+    };
+
+    void printUsage() {
+        fprintf(stderr, "usage: telemetry_decode [--summary] <telemetry.bin>...\n");
+    }
+
+    void printRecords(const std::vector<TelemetryRecord>& records) {
+        printf("index,type,elapsed_ms,value,cards_remaining,stock_count,undo_count\n");
+        for (size_t i = 0; i < records.size(); i++) {
+            const TelemetryRecord& r = records[i];
+            printf("%zu,%s,%u,%u,%u,%u,%u\n", i, TelemetryRecorder::getTypeName(r.type), r.elapsedMs, r.value,
+                   r.cardsRemaining, r.stockCount, r.undoCount);
+        }
+    }
+
+    void printSummaryLine(const GameSummary& game) {
+        double thinkMsMean = game.moves > 0 ? (double)game.thinkMsTotal / game.moves : 0.0;
+        printf("%08x,%s,%d,%d,%d,%d,%d,%d,%.0f,%u,%d,%d\n", game.levelId,
+               game.result == 1 ? "won" : (game.result == 0 ? "lost" : "unfinished"), game.moves,
+               game.typeCounts[TET_CARD_TAP], game.typeCounts[TET_STOCK_DRAW], game.typeCounts[TET_UNDO],
+               game.typeCounts[TET_MISMATCH], game.undoCount, thinkMsMean, game.thinkMsMax,
+               game.cardsRemaining, game.stockCount);
+    }
+
+    void printSummary(const std::vector<TelemetryRecord>& records) {
+        printf("level,result,moves,card_taps,stock_draws,undos,mismatches,undo_count,"
+               "think_ms_mean,think_ms_max,cards_remaining,stock_count\n");
+
+        GameSummary game;
+        bool inGame = false;
+        for (const TelemetryRecord& r : records) {
+            if (r.type == TET_LEVEL_START) {
+                if (inGame) printSummaryLine(game);
+                memset(&game, 0, sizeof(game));
+                game.levelId = r.value;
+                game.result = -1;
+                game.cardsRemaining = r.cardsRemaining;
+                game.stockCount = r.stockCount;
+                inGame = true;
+                continue;
+            }
+            if (!inGame) continue;
+
+            if (r.type <= TET_GAME_OVER) game.typeCounts[r.type]++;
+            game.cardsRemaining = r.cardsRemaining;
+            game.stockCount = r.stockCount;
+            game.undoCount = r.undoCount;
+
+            if (r.type == TET_GAME_OVER) {
+                game.result = r.value != 0 ? 1 : 0;
+                printSummaryLine(game);
+                inGame = false;
+                continue;
+            }
+            if (r.type == TET_CARD_TAP || r.type == TET_STOCK_DRAW || r.type == TET_UNDO) {
+                game.moves++;
+                game.thinkMsTotal += r.elapsedMs;
+                if (r.elapsedMs > game.thinkMsMax) game.thinkMsMax = r.elapsedMs;
+            }
+        }
+        if (inGame) printSummaryLine(game);
+    }
+}
+
+int main(int argc, char** argv) {
+    bool summary = false;
+    std::vector<std::string> paths;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--summary") == 0) summary = true;
+        else if (argv[i][0] == '-') {
+            printUsage();
+            return 1;
+        }
+        else paths.push_back(argv[i]);
+    }
+    if (paths.empty()) {
+        printUsage();
+        return 1;
+    }
+
+    std::vector<TelemetryRecord> records;
+    uint64_t droppedTotal = 0;
+    int status = 0;
+    for (const std::string& path : paths) {
+        uint64_t dropped = 0;
+        size_t before = records.size();
+        if (!TelemetryRecorder::readFile(path, records, dropped)) {
+            // һд;ֹѶļ¼ճ
+            fprintf(stderr, "%s: truncated or invalid after %zu records\n", path.c_str(), records.size() - before);
+            status = 2;
+        }
+        droppedTotal += dropped;
+    }
+
+    if (summary) printSummary(records);
+    else printRecords(records);
+
+    fprintf(stderr, "%zu records, %llu dropped while recording\n", records.size(), (unsigned long long)droppedTotal);
+    return status;
+}
@@ -0,0 +1,248 @@
+// --------------------------------------------------------
+// ļ: tools/tests/ReplayCodecTest.cpp
+// --------------------------------------------------------
+// ReplayCodec ԣλ߽硢zigzag ֵβӵĶݻطţ
+// ԼĲ GameSession طŵõԭʼͬľ
+//
+// ÷
+//   replay_codec_test        ȫͨ 0ʧ 1ctest עΪ replay_codec
+
+#include "services/GameSession.h"
+#include "services/LevelMaterializer.h"
+#include "services/ReplayCodec.h"
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+    int g_failures = 0;
+
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            g_failures++; \
+        } \
+    } while (0)
+
+    /**
+     * @brief һؽʱӦõʱ䣨һʱ䰴һƣ
+     */
+    std::vector<ReplayMove> encode(const std::vector<ReplayMove>& moves, uint16_t interval, std::vector<uint8_t>& out) {
+        ReplayWriter writer;
+        writer.begin(0x1122334455667788ULL, 0x0102030405060708ULL, MRT_GOLF, interval);
+        std::vector<ReplayMove> expected;
+        uint32_t lastTime = 0;
+        for (const auto& move : moves) {
+            writer.addMove(move.move, move.timeMs);
+            lastTime = move.timeMs > lastTime ? move.timeMs : lastTime;
+            ReplayMove decoded = { move.move, lastTime };
+            expected.push_back(decoded);
+        }
+        writer.finish(out);
+        return expected;
+    }
+
+    bool sameMove(const ReplayMove& a, const ReplayMove& b) {
+        return a.move == b.move && a.timeMs == b.timeMs;
+    }
+
+    /**
+     * @brief У±СֵиżԽֽ varintӳơʱ
+     */
+    std::vector<ReplayMove> makeMoves(int count, unsigned seed) {
+        std::mt19937 random(seed);
+        std::vector<ReplayMove> moves;
+        uint32_t time = 0;
+        for (int i = 0; i < count; i++) {
+            ReplayMove move;
+            int roll = (int)(random() % 10);
+            if (roll == 0) move.move = SMC_DRAW;
+            else if (roll == 1) move.move = SMC_UNDO;
+            else if (roll == 2) move.move = (int)(random() % 1000000);
+            else move.move = (int)(random() % 52);
+
+            int timeRoll = (int)(random() % 20);
+            if (timeRoll == 0 && time > 500) time -= 500;              // ʱӻ
+            else if (timeRoll == 1) time += 5000000;                   // ֽʱ
+            else time += (uint32_t)(random() % 3000);
+            move.timeMs = time;
+            moves.push_back(move);
+        }
+        return moves;
+    }
+
+    void testRoundTrip(int count, uint16_t interval) {
+        std::vector<uint8_t> data;
+        std::vector<ReplayMove> expected = encode(makeMoves(count, 20261019u + count), interval, data);
+
+        ReplayReader reader;
+        CHECK(reader.open(data.data(), data.size()));
+        CHECK(reader.getHeader().moveCount == (uint32_t)count);
+        CHECK(reader.getHeader().indexInterval == interval);
+        CHECK(reader.getHeader().matchRule == MRT_GOLF);
+        CHECK(reader.getHeader().levelHash == 0x1122334455667788ULL);
+        CHECK(reader.getHeader().seed == 0x0102030405060708ULL);
+        CHECK(reader.getEncodedSize() == data.size());
+
+        ReplayMove move;
+        for (int i = 0; i < count; i++) {
+            CHECK(reader.getPosition() == (uint32_t)i);
+            bool decoded = reader.next(move);
+            CHECK(decoded);
+            if (!decoded) return;
+            CHECK(sameMove(move, expected[i]));
+        }
+        CHECK(!reader.next(move));
+    }
+
+    void testSeek(int count, uint16_t interval) {
+        std::vector<uint8_t> data;
+        std::vector<ReplayMove> expected = encode(makeMoves(count, 7u + count), interval, data);
+
+        ReplayReader reader;
+        CHECK(reader.open(data.data(), data.size()));
+
+        // ÿһһ飬߽磨interval ǰһ
+        ReplayMove move;
+        for (int i = 0; i < count; i++) {
+            CHECK(reader.seek((uint32_t)i));
+            CHECK(reader.getPosition() == (uint32_t)i);
+            CHECK(reader.next(move) && sameMove(move, expected[i]));
+        }
+
+        // ǰ״̬һζλӰ
+        const int boundaries[] = { interval - 1, interval, interval + 1, 2 * interval, 0, count - 1 };
+        for (int target : boundaries) {
+            if (target < 0 || target >= count) continue;
+            CHECK(reader.seek((uint32_t)target));
+            for (int i = target; i < count && i < target + interval + 2; i++) {
+                CHECK(reader.next(move) && sameMove(move, expected[i]));
+            }
+        }
+
+        CHECK(reader.seek((uint32_t)count));
+        CHECK(!reader.next(move));
+        CHECK(!reader.seek((uint32_t)count + 1));
+    }
+
+    void testZigzagNegatives() {
+        // ֵ 0-1-4+1000000-1000000+51-51
+        const int cards[] = { 0, 0, 4, 3, 7, 3, 1000003, 3, 54, 3 };
+        std::vector<ReplayMove> moves;
+        for (int card : cards) {
+            ReplayMove move = { card, 0 };
+            moves.push_back(move);
+        }
+
+        std::vector<uint8_t> data;
+        encode(moves, ReplayWriter::kDefaultIndexInterval, data);
+        ReplayReader reader;
+        CHECK(reader.open(data.data(), data.size()));
+        ReplayMove move;
+        for (int card : cards) {
+            CHECK(reader.next(move) && move.move == card && move.timeMs == 0);
+        }
+
+        // ڿƣֵ 1ʱΪ 0Ǻʱ 1 ֽ
+        std::vector<uint8_t> small;
+        const int adjacent[] = { 1, 0, 1 };
+        std::vector<ReplayMove> adjacentMoves;
+        for (int card : adjacent) {
+            ReplayMove step = { card, 0 };
+            adjacentMoves.push_back(step);
+        }
+        encode(adjacentMoves, ReplayWriter::kDefaultIndexInterval, small);
+        CHECK(small.size() == ReplayWriter::kHeaderBytes + 3 * 2);
+    }
+
+    void testConcatenatedAndTruncated() {
+        std::vector<uint8_t> data;
+        std::vector<ReplayMove> first = encode(makeMoves(130, 1u), 64, data);
+        size_t firstSize = data.size();
+        std::vector<ReplayMove> second = encode(makeMoves(65, 2u), 64, data);
+
+        ReplayReader reader;
+        ReplayMove move;
+        CHECK(reader.open(data.data(), data.size()));
+        CHECK(reader.getEncodedSize() == firstSize);
+        CHECK(reader.seek(129) && reader.next(move) && sameMove(move, first[129]));
+
+        CHECK(reader.open(data.data() + firstSize, data.size() - firstSize));
+        CHECK(reader.getHeader().moveCount == 65);
+        CHECK(reader.seek(64) && reader.next(move) && sameMove(move, second[64]));
+
+        // ضϵĻطţһλܴ
+        CHECK(!reader.open(data.data(), firstSize - 1));
+    }
+
+    /**
+     * @brief ӻԭؿǷֱڻỰ Aͬʱ¼ƻطţ
+     *        ڻỰ BÿһĽϣ͵÷ֶӦ A ͬ
+     */
+    void testSessionReplay(uint64_t seed) {
+        LevelConfig config;
+        CHECK(LevelMaterializer::materialize(seed, config));
+        CompiledLevel level = CompiledLevel::compile(config);
+
+        MonotonicArena arenaA;
+        MonotonicArena arenaB;
+        GameSession direct;
+        GameSession replayed;
+        CHECK(direct.start(&level, arenaA));
+
+        std::mt19937 random((unsigned)seed);
+        ReplayWriter writer;
+        writer.begin(0, seed, config.matchRule);
+        std::vector<bool> applied;
+        std::vector<uint64_t> hashes;
+        for (int step = 0; step < 200 && !direct.isGameOver(); step++) {
+            int roll = (int)(random() % 10);
+            int move = roll == 0 ? SMC_UNDO : roll == 1 ? SMC_DRAW : (int)(random() % level.playfieldCount);
+            applied.push_back(direct.apply(move));
+            hashes.push_back(direct.getStateHash());
+            writer.addMove(move, (uint32_t)step * 100);
+        }
+
+        std::vector<uint8_t> data;
+        writer.finish(data);
+        ReplayReader reader;
+        CHECK(reader.open(data.data(), data.size()));
+        CHECK(replayed.start(&level, arenaB));
+
+        ReplayMove move;
+        for (size_t i = 0; i < applied.size(); i++) {
+            CHECK(reader.next(move));
+            CHECK(replayed.apply(move.move) == applied[i]);
+            CHECK(replayed.getStateHash() == hashes[i]);
+        }
+        CHECK(replayed.isGameOver() == direct.isGameOver());
+        CHECK(replayed.isWon() == direct.isWon());
+        CHECK(replayed.getScore() == direct.getScore());
+    }
+}
+
+int main() {
+    testRoundTrip(1, 64);
+    testRoundTrip(64, 64);
+    testRoundTrip(65, 64);
+    testRoundTrip(1000, 64);
+    testRoundTrip(300, 1);
+    testSeek(64, 64);
+    testSeek(128, 64);
+    testSeek(129, 64);
+    testSeek(300, 64);
+    testSeek(40, 1);
+    testZigzagNegatives();
+    testConcatenatedAndTruncated();
+    for (int layout = 0; layout < LLT_NUM_LAYOUTS; layout++) {
+        testSessionReplay(LevelMaterializer::makeSeed((LevelLayoutType)layout, 12345));
+    }
+
+    if (g_failures > 0) {
+        fprintf(stderr, "replay_codec_test: %d check(s) failed\n", g_failures);
+        return 1;
+    }
+    printf("replay_codec_test: all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,137 @@
+// --------------------------------------------------------
+// ļ: tools/validation_host/ValidationHost.cpp
+// --------------------------------------------------------
+#include "ValidationHost.h"
+
+const size_t ValidationHost::kChunkSize;
+
+const char* getVerdictName(ValidationVerdict verdict) {
+    switch (verdict) {
+        case VV_WON:            return "WON";
+        case VV_LOST:           return "LOST";
+        case VV_UNFINISHED:     return "UNFINISHED";
+        case VV_ILLEGAL_MOVE:   return "ILLEGAL";
+        case VV_INTERNAL_ERROR: return "INTERNAL_ERROR";
+        default:                return "UNKNOWN_LEVEL";
+    }
+}
+
+ValidationHost::ValidationHost(int threadCount)
+    : _batchId(0)
+    , _activeWorkers(0)
+    , _stopping(false)
+    , _requests(nullptr)
+    , _results(nullptr)
+    , _next(0) {
+    if (threadCount <= 0) {
+        threadCount = (int)std::thread::hardware_concurrency();
+        if (threadCount <= 0) threadCount = 1;
+    }
+    for (int i = 0; i < threadCount; i++) {
+        _workers.push_back(std::thread(&ValidationHost::workerLoop, this));
+    }
+}
+
+ValidationHost::~ValidationHost() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _batchReady.notify_all();
+    for (auto& worker : _workers) {
+        worker.join();
+    }
+}
+
+void ValidationHost::addLevel(int levelId, const LevelConfig& config) {
+    _levels[levelId].reset(new CompiledLevel(CompiledLevel::compile(config)));
+}
+
+void ValidationHost::validate(const std::vector<ValidationRequest>& requests, std::vector<ValidationResult>& results) {
+    results.resize(requests.size());
+    if (requests.empty()) return;
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    _requests = &requests;
+    _results = &results;
+    _next.store(0);
+    _activeWorkers = (int)_workers.size();
+    _batchId++;
+    _batchReady.notify_all();
+
+    _batchDone.wait(lock, [this]() { return _activeWorkers == 0; });
+    _requests = nullptr;
+    _results = nullptr;
+}
+
+ValidationResult ValidationHost::validateOne(const ValidationRequest& request, GameSession& session, MonotonicArena& arena) const {
+    ValidationResult result;
+    result.verdict = VV_UNKNOWN_LEVEL;
+    result.movesApplied = 0;
+    result.score = 0;
+    result.stateHash = 0;
+
+    auto found = _levels.find(request.levelId);
+    if (found == _levels.end()) return result;
+
+    arena.reset();
+    if (!session.start(found->second.get(), arena)) {
+        result.verdict = VV_INTERNAL_ERROR;
+        return result;
+    }
+
+    result.verdict = VV_UNFINISHED;
+    for (int move : request.moves) {
+        if (!session.apply(move)) {
+            result.verdict = VV_ILLEGAL_MOVE;
+            break;
+        }
+        result.movesApplied++;
+    }
+    if (result.verdict != VV_ILLEGAL_MOVE && session.isGameOver()) {
+        result.verdict = session.isWon() ? VV_WON : VV_LOST;
+    }
+
+    result.score = session.getScore();
+    result.stateHash = session.getStateHash()
+        ^ (request.seed * 0x9E3779B97F4A7C15ULL)
+        ^ ((uint64_t)(uint32_t)request.levelId << 32);
+    return result;
+}
+
+void ValidationHost::workerLoop() {
+    GameSession session;
+    MonotonicArena arena;
+    uint64_t seenBatch = 0;
+
+    while (true) {
+        const std::vector<ValidationRequest>* requests = nullptr;
+        std::vector<ValidationResult>* results = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _batchReady.wait(lock, [&]() { return _stopping || _batchId != seenBatch; });
+            if (_stopping) return;
+
+            seenBatch = _batchId;
+            requests = _requests;
+            results = _results;
+        }
+
+        // ȡԭӲ
+        size_t total = requests->size();
+        while (true) {
+            size_t begin = _next.fetch_add(kChunkSize);
+            if (begin >= total) break;
+
+            size_t end = begin + kChunkSize < total ? begin + kChunkSize : total;
+            for (size_t i = begin; i < end; i++) {
+                (*results)[i] = validateOne((*requests)[i], session, arena);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (--_activeWorkers == 0) {
+            _batchDone.notify_one();
+        }
+    }
+}
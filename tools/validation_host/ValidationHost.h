@@ -0,0 +1,120 @@
+// --------------------------------------------------------
+// ļ: tools/validation_host/ValidationHost.h
+// --------------------------------------------------------
+#ifndef __VALIDATION_HOST_H__
+#define __VALIDATION_HOST_H__
+
+#include "services/GameSession.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @struct ValidationRequest
+ * @brief һУύؿ +  + 
+ */
+struct ValidationRequest {
+    int levelId;
+    uint64_t seed;              ///< ؿӣվϣ
+    std::vector<int> moves;     ///< Ϸ±꣬ SMC_DRAW / SMC_UNDO
+};
+
+/**
+ * @enum ValidationVerdict
+ * @brief У
+ */
+enum ValidationVerdict {
+    VV_WON,             ///< ȫϷϷ
+    VV_LOST,            ///< ȫϷƿ߽
+    VV_UNFINISHED,      ///< ȫϷԾδ
+    VV_ILLEGAL_MOVE,    ///<  movesApplied ϷĶ
+    VV_UNKNOWN_LEVEL,   ///< ؿ ID δע
+    VV_INTERNAL_ERROR,  ///< Ự޷ʼ״̬ڴʧܣύ޹أӦУ
+    VV_COUNT
+};
+
+/**
+ * @struct ValidationResult
+ * @brief һύУ
+ */
+struct ValidationResult {
+    ValidationVerdict verdict;
+    int movesApplied;           ///< ϷִеĲ
+    int score;                  ///<  GameSession ĵ÷
+    uint64_t stateHash;         ///< վϣؿ ID
+};
+
+/**
+ * @brief У۵ıʽ
+ */
+const char* getVerdictName(ValidationVerdict verdict);
+
+/**
+ * @class ValidationHost
+ * @brief ỰУ̵ĺģ̶̳߳طύ
+ *
+ * ְ
+ * - Ԥֻؿ̹߳
+ * - ÿ̳߳һ GameSession һ MonotonicArenaÿύʼǰ
+ * - validate() һύָ̣߳ȫɺ󷵻
+ *
+ * ԭ
+ * - ߳ڹʱ̶̲֮߳˳
+ * - طŹ̲ڴ棺Ự״̬߳Լ arenaarena ڴ֮临
+ */
+class ValidationHost {
+public:
+    /**
+     * @param threadCount ߳0 ʾʹӲ߳
+     */
+    explicit ValidationHost(int threadCount = 0);
+    ~ValidationHost();
+
+    /**
+     * @brief עؿ validate ֮ǰã
+     */
+    void addLevel(int levelId, const LevelConfig& config);
+
+    /**
+     * @brief Уһύ
+     * @param requests ύб
+     * @param results  requests һһӦ
+     */
+    void validate(const std::vector<ValidationRequest>& requests, std::vector<ValidationResult>& results);
+
+    /**
+     * @brief ڵ߳У鵥ύ̳߳أ
+     */
+    ValidationResult validateOne(const ValidationRequest& request, GameSession& session, MonotonicArena& arena) const;
+
+    int getThreadCount() const { return (int)_workers.size(); }
+
+private:
+    ValidationHost(const ValidationHost&);
+    ValidationHost& operator=(const ValidationHost&);
+
+    static const size_t kChunkSize = 256;   ///< ߳ÿȡύ
+
+    void workerLoop();
+
+    std::map<int, std::unique_ptr<CompiledLevel>> _levels;
+
+    std::vector<std::thread> _workers;
+    std::mutex _mutex;
+    std::condition_variable _batchReady;
+    std::condition_variable _batchDone;
+    uint64_t _batchId;                                  ///< ÿεѹ߳
+    int _activeWorkers;                                 ///< δɵǰεĹ߳
+    bool _stopping;
+
+    const std::vector<ValidationRequest>* _requests;    ///< ǰΣڼЧ
+    std::vector<ValidationResult>* _results;
+    std::atomic<size_t> _next;                          ///< һȡύ±
+};
+
+#endif
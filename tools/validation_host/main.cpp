@@ -0,0 +1,382 @@
+// --------------------------------------------------------
+// ļ: tools/validation_host/main.cpp
+// --------------------------------------------------------
+// аύУ̣ȨطҵĲУۡ÷ֺվϣ
+//
+// ÷
+//   validation_host --level <id>=<level.json> [--level ...] [--threads N] [-i requests.txt] [-o results.txt]
+//   validation_host --level <id>=<level.json> [--level ...] --replays <replays.cmr> [-o results.txt]
+//   validation_host --level <id>=<level.json> --bench <count>
+//
+// ÿһύĬ stdinɽӹܵ
+//   <levelId> <seed> <moves>
+//   moves ԶŷָΪϷ IDD ΪƣU Ϊղд -
+//
+// --replays ΪȡƻطţReplayCodec ʽɶβӣļͷеĹؿǩƥ --level עĹؿ
+// --encode <replays.cmr> ıύͬʱתΪƻطţûʱ
+//
+// ÿһĬ stdout˳һ£
+//   <levelId> <seed> <WON|LOST|UNFINISHED|ILLEGAL|UNKNOWN_LEVEL|INTERNAL_ERROR> <movesApplied> <score> <stateHash>
+
+#include "LevelFileReader.h"
+#include "ValidationHost.h"
+#include "services/LevelSignature.h"
+#include "services/ReplayCodec.h"
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    const size_t kBatchSize = 65536;   ///< ÿύ
+
+    struct Options {
+        std::vector<std::pair<int, std::string>> levels;
+        int threads;
+        std::string input;
+        std::string output;
+        std::string replays;
+        std::string encode;
+        size_t bench;
+    };
+
+    /**
+     * @struct RegisteredLevel
+     * @brief עؿĻطűʶ
+     */
+    struct RegisteredLevel {
+        int levelId;
+        uint64_t levelHash;        ///< ɫ LevelSignatureطļͷһ
+        MatchRuleType matchRule;
+    };
+
+    void printUsage() {
+        fprintf(stderr, "usage: validation_host --level <id>=<level.json> [--level ...] [--threads N]"
+                        " [-i requests.txt | --replays <replays.cmr>] [-o results.txt] [--encode <replays.cmr>]"
+                        " [--bench <count>]\n");
+    }
+
+    bool parseOptions(int argc, char** argv, Options& options) {
+        options.threads = 0;
+        options.bench = 0;
+
+        for (int i = 1; i < argc; i++) {
+            if (strcmp(argv[i], "--level") == 0 && i + 1 < argc) {
+                const char* spec = argv[++i];
+                const char* separator = strchr(spec, '=');
+                if (!separator) return false;
+                options.levels.push_back(std::make_pair(atoi(spec), std::string(separator + 1)));
+            }
+            else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+                options.threads = atoi(argv[++i]);
+            }
+            else if (strcmp(argv[i], "-i") == 0 && i + 1 < argc) {
+                options.input = argv[++i];
+            }
+            else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+                options.output = argv[++i];
+            }
+            else if (strcmp(argv[i], "--replays") == 0 && i + 1 < argc) {
+                options.replays = argv[++i];
+            }
+            else if (strcmp(argv[i], "--encode") == 0 && i + 1 < argc) {
+                options.encode = argv[++i];
+            }
+            else if (strcmp(argv[i], "--bench") == 0 && i + 1 < argc) {
+                options.bench = (size_t)strtoull(argv[++i], nullptr, 10);
+            }
+            else {
+                return false;
+            }
+        }
+        return !options.levels.empty();
+    }
+
+    /**
+     * @brief һύʽ󷵻 false
+     */
+    bool parseRequest(const char* line, ValidationRequest& request) {
+        char* end = nullptr;
+        request.levelId = (int)strtol(line, &end, 10);
+        if (end == line) return false;
+
+        const char* cursor = end;
+        request.seed = (uint64_t)strtoull(cursor, &end, 10);
+        if (end == cursor) return false;
+
+        cursor = end;
+        while (*cursor == ' ' || *cursor == '\t') cursor++;
+
+        request.moves.clear();
+        if (*cursor == '-' && (cursor[1] == '\0' || cursor[1] == '\n' || cursor[1] == '\r')) return true;
+
+        while (*cursor && *cursor != '\n' && *cursor != '\r') {
+            if (*cursor == 'D') {
+                request.moves.push_back(SMC_DRAW);
+                cursor++;
+            }
+            else if (*cursor == 'U') {
+                request.moves.push_back(SMC_UNDO);
+                cursor++;
+            }
+            else {
+                long cardId = strtol(cursor, &end, 10);
+                if (end == cursor || cardId < 0) return false;
+                request.moves.push_back((int)cardId);
+                cursor = end;
+            }
+            if (*cursor == ',') cursor++;
+        }
+        return true;
+    }
+
+    void writeResults(FILE* out, const std::vector<ValidationRequest>& requests, const std::vector<ValidationResult>& results) {
+        for (size_t i = 0; i < requests.size(); i++) {
+            fprintf(out, "%d %" PRIu64 " %s %d %d %016" PRIx64 "\n", requests[i].levelId, requests[i].seed,
+                    getVerdictName(results[i].verdict), results[i].movesApplied, results[i].score, results[i].stateHash);
+        }
+    }
+
+    const RegisteredLevel* findLevelById(const std::vector<RegisteredLevel>& levels, int levelId) {
+        for (const auto& level : levels) {
+            if (level.levelId == levelId) return &level;
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief ύΪط׷ӵ outδעĹؿ
+     * @return Ļط
+     */
+    size_t encodeReplays(const std::vector<ValidationRequest>& requests, const std::vector<RegisteredLevel>& levels,
+                         std::vector<uint8_t>& out) {
+        ReplayWriter writer;
+        size_t encoded = 0;
+        for (const auto& request : requests) {
+            const RegisteredLevel* level = findLevelById(levels, request.levelId);
+            if (!level) continue;
+
+            writer.begin(level->levelHash, request.seed, level->matchRule);
+            writer.reserve(request.moves.size());
+            for (int move : request.moves) writer.addMove(move, 0);
+            writer.finish(out);
+            encoded++;
+        }
+        return encoded;
+    }
+
+    /**
+     * @brief ӻطݵ offset ˳ maxCount ݻط
+     * @return Ļطoffset ǰһݻطţʱͣ𻵴
+     */
+    size_t decodeReplays(const std::vector<uint8_t>& data, size_t& offset, size_t maxCount,
+                         const std::vector<RegisteredLevel>& levels, std::vector<ValidationRequest>& requests) {
+        ReplayReader reader;
+        ReplayMove move;
+        size_t decoded = 0;
+        while (decoded < maxCount && offset < data.size()) {
+            if (!reader.open(data.data() + offset, data.size() - offset)) break;
+
+            ValidationRequest request;
+            request.levelId = -1;
+            for (const auto& level : levels) {
+                if (level.levelHash == reader.getHeader().levelHash) {
+                    request.levelId = level.levelId;
+                    break;
+                }
+            }
+            request.seed = reader.getHeader().seed;
+            request.moves.reserve(reader.getHeader().moveCount);
+            while (reader.next(move)) request.moves.push_back(move.move);
+            if (request.moves.size() != reader.getHeader().moveCount) break;
+
+            requests.push_back(std::move(request));
+            offset += reader.getEncodedSize();
+            decoded++;
+        }
+        return decoded;
+    }
+
+    /**
+     * @brief ϷĲУƥĿƣżƿʱ
+     */
+    void generateBenchRequests(int levelId, const LevelConfig& config, size_t count,
+                               std::vector<ValidationRequest>& requests) {
+        CompiledLevel level = CompiledLevel::compile(config);
+        GameSession session;
+        MonotonicArena arena;
+        std::mt19937 rng(12345);
+
+        requests.resize(count);
+        for (size_t i = 0; i < count; i++) {
+            ValidationRequest& request = requests[i];
+            request.levelId = levelId;
+            request.seed = i;
+            request.moves.clear();
+
+            arena.reset();
+            if (!session.start(&level, arena)) continue;
+            while (!session.isGameOver() && request.moves.size() < 256) {
+                int move = SMC_UNDO;
+                if (rng() % 16 != 0 || !session.apply(SMC_UNDO)) {
+                    move = SMC_DRAW;
+                    for (int attempt = 0; attempt < level.playfieldCount; attempt++) {
+                        int candidate = (int)(rng() % level.playfieldCount);
+                        if (session.apply(candidate)) {
+                            move = candidate;
+                            break;
+                        }
+                    }
+                    if (move == SMC_DRAW && !session.apply(SMC_DRAW)) break;
+                }
+                request.moves.push_back(move);
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 1;
+    }
+
+    ValidationHost host(options.threads);
+    std::vector<LevelConfig> configs;
+    std::vector<RegisteredLevel> registered;
+    for (const auto& level : options.levels) {
+        LevelConfig config;
+        std::string error;
+        if (!readLevelFile(level.second, config, error)) {
+            fprintf(stderr, "error: %s: %s\n", level.second.c_str(), error.c_str());
+            return 1;
+        }
+        host.addLevel(level.first, config);
+        configs.push_back(config);
+
+        RegisteredLevel entry;
+        entry.levelId = level.first;
+        entry.levelHash = LevelSignature::compute(config, true);
+        entry.matchRule = config.matchRule;
+        registered.push_back(entry);
+    }
+
+    std::vector<ValidationRequest> requests;
+    std::vector<ValidationResult> results;
+
+    // ѹ⣺ύֻʱ validate 
+    if (options.bench > 0) {
+        generateBenchRequests(options.levels[0].first, configs[0], options.bench, requests);
+
+        size_t totalMoves = 0;
+        for (const auto& request : requests) totalMoves += request.moves.size();
+
+        auto begin = std::chrono::steady_clock::now();
+        host.validate(requests, results);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+        size_t counts[VV_COUNT] = {};
+        for (const auto& result : results) counts[result.verdict]++;
+        printf("%zu validations (%zu moves) on %d thread(s) in %.3fs: %.0f validations/s\n",
+               requests.size(), totalMoves, host.getThreadCount(), seconds, requests.size() / seconds);
+        printf("verdicts: won %zu, lost %zu, unfinished %zu, illegal %zu, internal error %zu\n",
+               counts[VV_WON], counts[VV_LOST], counts[VV_UNFINISHED], counts[VV_ILLEGAL_MOVE],
+               counts[VV_INTERNAL_ERROR]);
+
+        // طŸʽ͵߳˳ٶ
+        std::vector<uint8_t> encoded;
+        encodeReplays(requests, registered, encoded);
+        std::vector<ValidationRequest> decoded;
+        decoded.reserve(requests.size());
+        size_t offset = 0;
+        begin = std::chrono::steady_clock::now();
+        decodeReplays(encoded, offset, requests.size(), registered, decoded);
+        seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        printf("replays: %zu bytes, %.2f bytes/move including headers, decoded %zu in %.3fs: %.0f moves/s\n",
+               encoded.size(), totalMoves > 0 ? (double)encoded.size() / totalMoves : 0.0, decoded.size(), seconds,
+               totalMoves / seconds);
+        return 0;
+    }
+
+    // ƻطţļڴ棬롢У顢д
+    if (!options.replays.empty()) {
+        std::string content;
+        if (!readTextFile(options.replays, content)) {
+            fprintf(stderr, "error: cannot open %s\n", options.replays.c_str());
+            return 1;
+        }
+        FILE* out = options.output.empty() ? stdout : fopen(options.output.c_str(), "w");
+        if (!out) {
+            fprintf(stderr, "error: cannot open %s\n", options.output.c_str());
+            return 1;
+        }
+
+        std::vector<uint8_t> data(content.begin(), content.end());
+        content.clear();
+        size_t offset = 0;
+        while (offset < data.size()) {
+            requests.clear();
+            if (decodeReplays(data, offset, kBatchSize, registered, requests) == 0) {
+                fprintf(stderr, "warning: invalid replay at byte %zu, rest of file skipped\n", offset);
+                break;
+            }
+            host.validate(requests, results);
+            writeResults(out, requests, results);
+        }
+
+        if (out != stdout) fclose(out);
+        return 0;
+    }
+
+    FILE* in = options.input.empty() ? stdin : fopen(options.input.c_str(), "r");
+    FILE* out = options.output.empty() ? stdout : fopen(options.output.c_str(), "w");
+    FILE* encodeOut = options.encode.empty() ? nullptr : fopen(options.encode.c_str(), "wb");
+    if (!in || !out || (!options.encode.empty() && !encodeOut)) {
+        fprintf(stderr, "error: cannot open %s\n", !in ? options.input.c_str()
+                : (!out ? options.output.c_str() : options.encode.c_str()));
+        return 1;
+    }
+    std::vector<uint8_t> encoded;
+
+    // 롢У顢д˳һ
+    char line[65536];
+    int lineNumber = 0;
+    bool eof = false;
+    while (!eof) {
+        requests.clear();
+        while (requests.size() < kBatchSize) {
+            if (!fgets(line, sizeof(line), in)) {
+                eof = true;
+                break;
+            }
+            lineNumber++;
+            if (line[0] == '#' || line[0] == '\n' || line[0] == '\r') continue;
+
+            ValidationRequest request;
+            if (!parseRequest(line, request)) {
+                fprintf(stderr, "warning: line %d malformed, skipped\n", lineNumber);
+                continue;
+            }
+            requests.push_back(request);
+        }
+
+        host.validate(requests, results);
+        writeResults(out, requests, results);
+
+        if (encodeOut) {
+            encoded.clear();
+            encodeReplays(requests, registered, encoded);
+            fwrite(encoded.data(), 1, encoded.size(), encodeOut);
+        }
+    }
+
+    if (encodeOut) fclose(encodeOut);
+    if (in != stdin) fclose(in);
+    if (out != stdout) fclose(out);
+    return 0;
+}